@@ -261,6 +261,132 @@
 #endif
 #define  gsl_FEATURE_EXPERIMENTAL_RETURN_GUARD_()  gsl_FEATURE_EXPERIMENTAL_RETURN_GUARD
 
+#if defined( gsl_FEATURE_EXPERIMENTAL_ATOMIC_NOT_NULL )
+# if ! gsl_CHECK_CFG_TOGGLE_VALUE_( gsl_FEATURE_EXPERIMENTAL_ATOMIC_NOT_NULL )
+#  pragma message (__FILE__ "(" gsl_STRINGIFY( __LINE__ ) "): warning: invalid configuration value gsl_FEATURE_EXPERIMENTAL_ATOMIC_NOT_NULL=" gsl_STRINGIFY(gsl_FEATURE_EXPERIMENTAL_ATOMIC_NOT_NULL) ", must be 0 or 1")
+# endif
+#else
+# define gsl_FEATURE_EXPERIMENTAL_ATOMIC_NOT_NULL  0 // default
+#endif
+#define  gsl_FEATURE_EXPERIMENTAL_ATOMIC_NOT_NULL_()  gsl_FEATURE_EXPERIMENTAL_ATOMIC_NOT_NULL
+
+#if defined( gsl_FEATURE_EXPERIMENTAL_INTRUSIVE_PTR )
+# if ! gsl_CHECK_CFG_TOGGLE_VALUE_( gsl_FEATURE_EXPERIMENTAL_INTRUSIVE_PTR )
+#  pragma message (__FILE__ "(" gsl_STRINGIFY( __LINE__ ) "): warning: invalid configuration value gsl_FEATURE_EXPERIMENTAL_INTRUSIVE_PTR=" gsl_STRINGIFY(gsl_FEATURE_EXPERIMENTAL_INTRUSIVE_PTR) ", must be 0 or 1")
+# endif
+#else
+# define gsl_FEATURE_EXPERIMENTAL_INTRUSIVE_PTR  0 // default
+#endif
+#define  gsl_FEATURE_EXPERIMENTAL_INTRUSIVE_PTR_()  gsl_FEATURE_EXPERIMENTAL_INTRUSIVE_PTR
+
+#if defined( gsl_FEATURE_EXPERIMENTAL_SLOT_MAP )
+# if ! gsl_CHECK_CFG_TOGGLE_VALUE_( gsl_FEATURE_EXPERIMENTAL_SLOT_MAP )
+#  pragma message (__FILE__ "(" gsl_STRINGIFY( __LINE__ ) "): warning: invalid configuration value gsl_FEATURE_EXPERIMENTAL_SLOT_MAP=" gsl_STRINGIFY(gsl_FEATURE_EXPERIMENTAL_SLOT_MAP) ", must be 0 or 1")
+# endif
+#else
+# define gsl_FEATURE_EXPERIMENTAL_SLOT_MAP  0 // default
+#endif
+#define  gsl_FEATURE_EXPERIMENTAL_SLOT_MAP_()  gsl_FEATURE_EXPERIMENTAL_SLOT_MAP
+
+#if defined( gsl_FEATURE_EXPERIMENTAL_ARENA )
+# if ! gsl_CHECK_CFG_TOGGLE_VALUE_( gsl_FEATURE_EXPERIMENTAL_ARENA )
+#  pragma message (__FILE__ "(" gsl_STRINGIFY( __LINE__ ) "): warning: invalid configuration value gsl_FEATURE_EXPERIMENTAL_ARENA=" gsl_STRINGIFY(gsl_FEATURE_EXPERIMENTAL_ARENA) ", must be 0 or 1")
+# endif
+#else
+# define gsl_FEATURE_EXPERIMENTAL_ARENA  0 // default
+#endif
+#define  gsl_FEATURE_EXPERIMENTAL_ARENA_()  gsl_FEATURE_EXPERIMENTAL_ARENA
+
+#if defined( gsl_FEATURE_EXPERIMENTAL_OBJECT_POOL )
+# if ! gsl_CHECK_CFG_TOGGLE_VALUE_( gsl_FEATURE_EXPERIMENTAL_OBJECT_POOL )
+#  pragma message (__FILE__ "(" gsl_STRINGIFY( __LINE__ ) "): warning: invalid configuration value gsl_FEATURE_EXPERIMENTAL_OBJECT_POOL=" gsl_STRINGIFY(gsl_FEATURE_EXPERIMENTAL_OBJECT_POOL) ", must be 0 or 1")
+# endif
+#else
+# define gsl_FEATURE_EXPERIMENTAL_OBJECT_POOL  0 // default
+#endif
+#define  gsl_FEATURE_EXPERIMENTAL_OBJECT_POOL_()  gsl_FEATURE_EXPERIMENTAL_OBJECT_POOL
+
+#if defined( gsl_FEATURE_EXPERIMENTAL_INPLACE_VECTOR )
+# if ! gsl_CHECK_CFG_TOGGLE_VALUE_( gsl_FEATURE_EXPERIMENTAL_INPLACE_VECTOR )
+#  pragma message (__FILE__ "(" gsl_STRINGIFY( __LINE__ ) "): warning: invalid configuration value gsl_FEATURE_EXPERIMENTAL_INPLACE_VECTOR=" gsl_STRINGIFY(gsl_FEATURE_EXPERIMENTAL_INPLACE_VECTOR) ", must be 0 or 1")
+# endif
+#else
+# define gsl_FEATURE_EXPERIMENTAL_INPLACE_VECTOR  0 // default
+#endif
+#define  gsl_FEATURE_EXPERIMENTAL_INPLACE_VECTOR_()  gsl_FEATURE_EXPERIMENTAL_INPLACE_VECTOR
+
+#if defined( gsl_FEATURE_EXPERIMENTAL_DYN_ARRAY )
+# if ! gsl_CHECK_CFG_TOGGLE_VALUE_( gsl_FEATURE_EXPERIMENTAL_DYN_ARRAY )
+#  pragma message (__FILE__ "(" gsl_STRINGIFY( __LINE__ ) "): warning: invalid configuration value gsl_FEATURE_EXPERIMENTAL_DYN_ARRAY=" gsl_STRINGIFY(gsl_FEATURE_EXPERIMENTAL_DYN_ARRAY) ", must be 0 or 1")
+# endif
+#else
+# define gsl_FEATURE_EXPERIMENTAL_DYN_ARRAY  0 // default
+#endif
+#define  gsl_FEATURE_EXPERIMENTAL_DYN_ARRAY_()  gsl_FEATURE_EXPERIMENTAL_DYN_ARRAY
+
+#if defined( gsl_FEATURE_EXPERIMENTAL_SMALL_BUFFER )
+# if ! gsl_CHECK_CFG_TOGGLE_VALUE_( gsl_FEATURE_EXPERIMENTAL_SMALL_BUFFER )
+#  pragma message (__FILE__ "(" gsl_STRINGIFY( __LINE__ ) "): warning: invalid configuration value gsl_FEATURE_EXPERIMENTAL_SMALL_BUFFER=" gsl_STRINGIFY(gsl_FEATURE_EXPERIMENTAL_SMALL_BUFFER) ", must be 0 or 1")
+# endif
+#else
+# define gsl_FEATURE_EXPERIMENTAL_SMALL_BUFFER  0 // default
+#endif
+#define  gsl_FEATURE_EXPERIMENTAL_SMALL_BUFFER_()  gsl_FEATURE_EXPERIMENTAL_SMALL_BUFFER
+
+#if defined( gsl_FEATURE_EXPERIMENTAL_SPSC_RING )
+# if ! gsl_CHECK_CFG_TOGGLE_VALUE_( gsl_FEATURE_EXPERIMENTAL_SPSC_RING )
+#  pragma message (__FILE__ "(" gsl_STRINGIFY( __LINE__ ) "): warning: invalid configuration value gsl_FEATURE_EXPERIMENTAL_SPSC_RING=" gsl_STRINGIFY(gsl_FEATURE_EXPERIMENTAL_SPSC_RING) ", must be 0 or 1")
+# endif
+#else
+# define gsl_FEATURE_EXPERIMENTAL_SPSC_RING  0 // default
+#endif
+#define  gsl_FEATURE_EXPERIMENTAL_SPSC_RING_()  gsl_FEATURE_EXPERIMENTAL_SPSC_RING
+
+#if defined( gsl_FEATURE_EXPERIMENTAL_MPMC_QUEUE )
+# if ! gsl_CHECK_CFG_TOGGLE_VALUE_( gsl_FEATURE_EXPERIMENTAL_MPMC_QUEUE )
+#  pragma message (__FILE__ "(" gsl_STRINGIFY( __LINE__ ) "): warning: invalid configuration value gsl_FEATURE_EXPERIMENTAL_MPMC_QUEUE=" gsl_STRINGIFY(gsl_FEATURE_EXPERIMENTAL_MPMC_QUEUE) ", must be 0 or 1")
+# endif
+#else
+# define gsl_FEATURE_EXPERIMENTAL_MPMC_QUEUE  0 // default
+#endif
+#define  gsl_FEATURE_EXPERIMENTAL_MPMC_QUEUE_()  gsl_FEATURE_EXPERIMENTAL_MPMC_QUEUE
+
+#if defined( gsl_FEATURE_EXPERIMENTAL_CIRCULAR_SPAN )
+# if ! gsl_CHECK_CFG_TOGGLE_VALUE_( gsl_FEATURE_EXPERIMENTAL_CIRCULAR_SPAN )
+#  pragma message (__FILE__ "(" gsl_STRINGIFY( __LINE__ ) "): warning: invalid configuration value gsl_FEATURE_EXPERIMENTAL_CIRCULAR_SPAN=" gsl_STRINGIFY(gsl_FEATURE_EXPERIMENTAL_CIRCULAR_SPAN) ", must be 0 or 1")
+# endif
+#else
+# define gsl_FEATURE_EXPERIMENTAL_CIRCULAR_SPAN  0 // default
+#endif
+#define  gsl_FEATURE_EXPERIMENTAL_CIRCULAR_SPAN_()  gsl_FEATURE_EXPERIMENTAL_CIRCULAR_SPAN
+
+#if defined( gsl_FEATURE_EXPERIMENTAL_PARALLEL )
+# if ! gsl_CHECK_CFG_TOGGLE_VALUE_( gsl_FEATURE_EXPERIMENTAL_PARALLEL )
+#  pragma message (__FILE__ "(" gsl_STRINGIFY( __LINE__ ) "): warning: invalid configuration value gsl_FEATURE_EXPERIMENTAL_PARALLEL=" gsl_STRINGIFY(gsl_FEATURE_EXPERIMENTAL_PARALLEL) ", must be 0 or 1")
+# endif
+#else
+# define gsl_FEATURE_EXPERIMENTAL_PARALLEL  0 // default
+#endif
+#define  gsl_FEATURE_EXPERIMENTAL_PARALLEL_()  gsl_FEATURE_EXPERIMENTAL_PARALLEL
+
+#if defined( gsl_FEATURE_EXPERIMENTAL_SORT )
+# if ! gsl_CHECK_CFG_TOGGLE_VALUE_( gsl_FEATURE_EXPERIMENTAL_SORT )
+#  pragma message (__FILE__ "(" gsl_STRINGIFY( __LINE__ ) "): warning: invalid configuration value gsl_FEATURE_EXPERIMENTAL_SORT=" gsl_STRINGIFY(gsl_FEATURE_EXPERIMENTAL_SORT) ", must be 0 or 1")
+# endif
+#else
+# define gsl_FEATURE_EXPERIMENTAL_SORT  0 // default
+#endif
+#define  gsl_FEATURE_EXPERIMENTAL_SORT_()  gsl_FEATURE_EXPERIMENTAL_SORT
+
+#if defined( gsl_FEATURE_EXPERIMENTAL_NUMERIC )
+# if ! gsl_CHECK_CFG_TOGGLE_VALUE_( gsl_FEATURE_EXPERIMENTAL_NUMERIC )
+#  pragma message (__FILE__ "(" gsl_STRINGIFY( __LINE__ ) "): warning: invalid configuration value gsl_FEATURE_EXPERIMENTAL_NUMERIC=" gsl_STRINGIFY(gsl_FEATURE_EXPERIMENTAL_NUMERIC) ", must be 0 or 1")
+# endif
+#else
+# define gsl_FEATURE_EXPERIMENTAL_NUMERIC  0 // default
+#endif
+#define  gsl_FEATURE_EXPERIMENTAL_NUMERIC_()  gsl_FEATURE_EXPERIMENTAL_NUMERIC
+
 #if defined( gsl_FEATURE_GSL_LITE_NAMESPACE )
 # if ! gsl_CHECK_CFG_TOGGLE_VALUE_( gsl_FEATURE_GSL_LITE_NAMESPACE )
 #  pragma message (__FILE__ "(" gsl_STRINGIFY( __LINE__ ) "): warning: invalid configuration value gsl_FEATURE_GSL_LITE_NAMESPACE=" gsl_STRINGIFY(gsl_FEATURE_GSL_LITE_NAMESPACE) ", must be 0 or 1")
@@ -399,6 +525,52 @@
 #endif
 #define  gsl_CONFIG_VALIDATES_UNENFORCED_CONTRACT_EXPRESSIONS_()  gsl_CONFIG_VALIDATES_UNENFORCED_CONTRACT_EXPRESSIONS
 
+#if defined( gsl_CONFIG_USE_SIGNAL_SAFE_ASSERTION_HANDLER )
+# if ! gsl_CHECK_CFG_TOGGLE_VALUE_( gsl_CONFIG_USE_SIGNAL_SAFE_ASSERTION_HANDLER )
+#  pragma message (__FILE__ "(" gsl_STRINGIFY( __LINE__ ) "): warning: invalid configuration value gsl_CONFIG_USE_SIGNAL_SAFE_ASSERTION_HANDLER=" gsl_STRINGIFY(gsl_CONFIG_USE_SIGNAL_SAFE_ASSERTION_HANDLER) ", must be 0 or 1")
+# endif
+#else
+// gsl_CONFIG_USE_SIGNAL_SAFE_ASSERTION_HANDLER=1: Report contract violations with `write()` to the standard error stream, without allocating memory.
+# define gsl_CONFIG_USE_SIGNAL_SAFE_ASSERTION_HANDLER  0  // default
+#endif
+#define  gsl_CONFIG_USE_SIGNAL_SAFE_ASSERTION_HANDLER_()  gsl_CONFIG_USE_SIGNAL_SAFE_ASSERTION_HANDLER
+
+#if defined( gsl_CONFIG_SIGNAL_SAFE_ASSERTION_HANDLER_PRINTS_BACKTRACE )
+# if ! gsl_CHECK_CFG_TOGGLE_VALUE_( gsl_CONFIG_SIGNAL_SAFE_ASSERTION_HANDLER_PRINTS_BACKTRACE )
+#  pragma message (__FILE__ "(" gsl_STRINGIFY( __LINE__ ) "): warning: invalid configuration value gsl_CONFIG_SIGNAL_SAFE_ASSERTION_HANDLER_PRINTS_BACKTRACE=" gsl_STRINGIFY(gsl_CONFIG_SIGNAL_SAFE_ASSERTION_HANDLER_PRINTS_BACKTRACE) ", must be 0 or 1")
+# endif
+#else
+# define gsl_CONFIG_SIGNAL_SAFE_ASSERTION_HANDLER_PRINTS_BACKTRACE  0  // default
+#endif
+#define  gsl_CONFIG_SIGNAL_SAFE_ASSERTION_HANDLER_PRINTS_BACKTRACE_()  gsl_CONFIG_SIGNAL_SAFE_ASSERTION_HANDLER_PRINTS_BACKTRACE
+
+#if defined( gsl_CONFIG_RAW_STACKTRACE )
+# if ! gsl_CHECK_CFG_TOGGLE_VALUE_( gsl_CONFIG_RAW_STACKTRACE )
+#  pragma message (__FILE__ "(" gsl_STRINGIFY( __LINE__ ) "): warning: invalid configuration value gsl_CONFIG_RAW_STACKTRACE=" gsl_STRINGIFY(gsl_CONFIG_RAW_STACKTRACE) ", must be 0 or 1")
+# endif
+#else
+// gsl_CONFIG_RAW_STACKTRACE=1: With gsl_CONFIG_CONTRACT_VIOLATION_TERMINATES_WITH_STACKTRACE, print raw return addresses as module offsets
+// instead of symbolizing them with `std::stacktrace`.
+# define gsl_CONFIG_RAW_STACKTRACE  0  // default
+#endif
+#define  gsl_CONFIG_RAW_STACKTRACE_()  gsl_CONFIG_RAW_STACKTRACE
+
+#if defined( gsl_CONFIG_TRACK_OWNERS )
+# if ! gsl_CHECK_CFG_TOGGLE_VALUE_( gsl_CONFIG_TRACK_OWNERS )
+#  pragma message (__FILE__ "(" gsl_STRINGIFY( __LINE__ ) "): warning: invalid configuration value gsl_CONFIG_TRACK_OWNERS=" gsl_STRINGIFY(gsl_CONFIG_TRACK_OWNERS) ", must be 0 or 1")
+# endif
+#else
+// gsl_CONFIG_TRACK_OWNERS=1: Record owning pointers annotated with `gsl_TRACK_OWNER()` along with their allocation site, and
+// report the ones which are still alive at exit.
+# define gsl_CONFIG_TRACK_OWNERS  0  // default
+#endif
+#define  gsl_CONFIG_TRACK_OWNERS_()  gsl_CONFIG_TRACK_OWNERS
+
+#if ! defined( gsl_CONFIG_CACHE_LINE_SIZE )
+// gsl_CONFIG_CACHE_LINE_SIZE: Alignment used to keep data modified by different threads on separate cache lines.
+# define gsl_CONFIG_CACHE_LINE_SIZE  64  // default
+#endif
+
 #if defined( gsl_CONFIG_USE_CRT_ASSERTION_HANDLER )
 # if ! gsl_CHECK_CFG_TOGGLE_VALUE_( gsl_CONFIG_USE_CRT_ASSERTION_HANDLER )
 #  pragma message (__FILE__ "(" gsl_STRINGIFY( __LINE__ ) "): warning: invalid configuration value gsl_CONFIG_USE_CRT_ASSERTION_HANDLER=" gsl_STRINGIFY(gsl_CONFIG_USE_CRT_ASSERTION_HANDLER) ", must be 0 or 1")
@@ -407,7 +579,9 @@
 // gsl_CONFIG_USE_CRT_ASSERTION_HANDLER=1: Call the CRT assertion handler (`_assert()` for MSVC, `__assert_fail()` for Linux, `__assert()` otherwise).
 // gsl_CONFIG_USE_CRT_ASSERTION_HANDLER=0: Use the `assert()` macro if available, or call `abort()` directly if not.
 // We default to 1 if we can be sure that the CRT assertion handler is accessible, and 0 otherwise.
-# if defined( _MSC_VER ) || defined( __linux__ )
+# if gsl_CONFIG_USE_SIGNAL_SAFE_ASSERTION_HANDLER
+#  define gsl_CONFIG_USE_CRT_ASSERTION_HANDLER  0
+# elif defined( _MSC_VER ) || defined( __linux__ )
 #  define gsl_CONFIG_USE_CRT_ASSERTION_HANDLER  1
 # else
 #  define gsl_CONFIG_USE_CRT_ASSERTION_HANDLER  0
@@ -415,6 +589,10 @@
 #endif
 #define  gsl_CONFIG_USE_CRT_ASSERTION_HANDLER_()  gsl_CONFIG_USE_CRT_ASSERTION_HANDLER
 
+#if gsl_CONFIG_USE_CRT_ASSERTION_HANDLER && gsl_CONFIG_USE_SIGNAL_SAFE_ASSERTION_HANDLER
+# error gsl_CONFIG_USE_CRT_ASSERTION_HANDLER and gsl_CONFIG_USE_SIGNAL_SAFE_ASSERTION_HANDLER cannot both be set to 1
+#endif
+
 #if defined( gsl_CONFIG_CONTRACT_CHECKING_EXPECTS_OFF )
 # if ! gsl_CHECK_CFG_NO_VALUE_( gsl_CONFIG_CONTRACT_CHECKING_EXPECTS_OFF )
 #  pragma message (__FILE__ "(" gsl_STRINGIFY( __LINE__ ) "): warning: invalid configuration value gsl_CONFIG_CONTRACT_CHECKING_EXPECTS_OFF=" gsl_STRINGIFY(gsl_CONFIG_CONTRACT_CHECKING_EXPECTS_OFF) "; macro must be defined without value")
@@ -1368,14 +1546,45 @@
 #if gsl_FEATURE( STRING_SPAN ) || defined( gsl_CONFIG_CONTRACT_VIOLATION_THROWS ) || ( defined( gsl_CONFIG_CONTRACT_VIOLATION_ASSERTS ) && gsl_CONFIG( USE_CRT_ASSERTION_HANDLER ) && ! ( gsl_COMPILER_MS_STL_VERSION && ! defined( _DEBUG ) ) && ! defined( __linux__ ) )
 # include <string>
 #endif
+#if ( defined( gsl_CONFIG_CONTRACT_VIOLATION_ASSERTS ) && gsl_CONFIG( USE_SIGNAL_SAFE_ASSERTION_HANDLER ) ) || ( defined( gsl_CONFIG_CONTRACT_VIOLATION_TERMINATES_WITH_STACKTRACE ) && gsl_CONFIG( RAW_STACKTRACE ) )
+# define gsl_WRITES_TO_STDERR_  1
+# include <cerrno>
+# if defined( _WIN32 )
+#  include <io.h>      // for _write()
+# else
+#  include <unistd.h>  // for write(), STDERR_FILENO
+# endif
+#else
+# define gsl_WRITES_TO_STDERR_  0
+#endif
 #if defined( gsl_CONFIG_CONTRACT_VIOLATION_ASSERTS ) && ! gsl_CONFIG( USE_CRT_ASSERTION_HANDLER )
-# include <cstdio>
+# if gsl_CONFIG( USE_SIGNAL_SAFE_ASSERTION_HANDLER )
+#  if gsl_CONFIG( SIGNAL_SAFE_ASSERTION_HANDLER_PRINTS_BACKTRACE )
+#   if defined( __GLIBC__ ) || defined( __APPLE__ ) || defined( __FreeBSD__ )
+#    include <execinfo.h>  // for backtrace(), backtrace_symbols_fd()
+#   else
+#    error gsl_CONFIG_SIGNAL_SAFE_ASSERTION_HANDLER_PRINTS_BACKTRACE: backtrace_symbols_fd() is not available for this platform
+#   endif
+#  endif
+# else // ! gsl_CONFIG( USE_SIGNAL_SAFE_ASSERTION_HANDLER )
+#  include <cstdio>
+# endif
 #endif
 
 #if ! gsl_CPP11_OR_GREATER
 # include <algorithm> // for swap() before C++11
 #endif
 
+#if gsl_CONFIG( TRACK_OWNERS )
+# if ! gsl_STDLIB_CPP11_OR_GREATER
+#  error gsl_CONFIG_TRACK_OWNERS: requires C++11 or higher
+# endif
+# include <atomic>
+# include <cstdint>
+# include <cstdio>
+# include <new>
+#endif
+
 #if gsl_HAVE( ARRAY )
 # include <array> // indirectly includes reverse_iterator<>
 #endif
@@ -1400,6 +1609,103 @@
 # include <initializer_list>
 #endif
 
+#if gsl_HAVE( SIZED_TYPES )
+# include <cstdint> // for uintptr_t
+#endif
+
+#if gsl_FEATURE( EXPERIMENTAL_ATOMIC_NOT_NULL ) && gsl_STDLIB_CPP11_OR_GREATER
+# include <atomic>
+# include <vector>
+#endif
+
+#if gsl_FEATURE( EXPERIMENTAL_INTRUSIVE_PTR ) && gsl_STDLIB_CPP11_OR_GREATER
+# include <atomic>
+#endif
+
+#if gsl_FEATURE( EXPERIMENTAL_SLOT_MAP ) && gsl_STDLIB_CPP11_OR_GREATER
+# include <vector>
+#endif
+
+#if gsl_FEATURE( EXPERIMENTAL_OBJECT_POOL ) && gsl_STDLIB_CPP11_OR_GREATER
+# include <atomic>
+# include <new>
+#endif
+
+#if gsl_FEATURE( EXPERIMENTAL_INPLACE_VECTOR ) && gsl_STDLIB_CPP11_OR_GREATER
+# include <iterator>
+# include <new>
+#endif
+
+#if gsl_FEATURE( EXPERIMENTAL_DYN_ARRAY ) && gsl_STDLIB_CPP11_OR_GREATER
+# include <iterator>
+# include <memory>
+# include <new>
+#endif
+
+#if gsl_FEATURE( EXPERIMENTAL_SMALL_BUFFER ) && gsl_STDLIB_CPP11_OR_GREATER
+# include <memory>
+# include <new>
+#endif
+
+#if gsl_FEATURE( EXPERIMENTAL_SPSC_RING ) && gsl_STDLIB_CPP11_OR_GREATER
+# include <atomic>
+#endif
+
+#if gsl_FEATURE( EXPERIMENTAL_MPMC_QUEUE ) && gsl_STDLIB_CPP11_OR_GREATER
+# include <atomic>
+# include <thread>  // for this_thread::yield()
+#endif
+
+#if gsl_FEATURE( EXPERIMENTAL_CIRCULAR_SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+# include <iterator>
+#endif
+
+#if gsl_FEATURE( EXPERIMENTAL_PARALLEL ) && gsl_STDLIB_CPP11_OR_GREATER
+# include <atomic>
+# include <condition_variable>
+# include <cstdint>
+# include <deque>
+# include <exception>
+# include <memory>
+# include <mutex>
+# include <thread>
+# include <vector>
+#endif
+
+#if gsl_FEATURE( EXPERIMENTAL_SORT ) && gsl_STDLIB_CPP11_OR_GREATER
+# include <algorithm>
+# include <cstdint>
+# include <cstring>
+# include <functional>
+# include <iterator>
+#endif
+
+#if gsl_FEATURE( EXPERIMENTAL_NUMERIC ) && gsl_STDLIB_CPP11_OR_GREATER
+# include <utility>  // for pair<>
+#endif
+
+#if gsl_FEATURE( EXPERIMENTAL_ARENA ) && gsl_STDLIB_CPP11_OR_GREATER
+# include <new>
+# if defined( __cpp_lib_memory_resource )
+#  include <memory_resource>
+# endif
+# if defined( __SANITIZE_ADDRESS__ )
+#  define gsl_ADDRESS_SANITIZER_  1
+# elif defined( __has_feature )
+#  if __has_feature( address_sanitizer )
+#   define gsl_ADDRESS_SANITIZER_  1
+#  endif
+# endif
+# if defined( gsl_ADDRESS_SANITIZER_ )
+#  include <sanitizer/asan_interface.h>
+#  define gsl_POISON_MEMORY_REGION_( p, n )    ASAN_POISON_MEMORY_REGION( p, n )
+#  define gsl_UNPOISON_MEMORY_REGION_( p, n )  ASAN_UNPOISON_MEMORY_REGION( p, n )
+# else
+#  define gsl_POISON_MEMORY_REGION_( p, n )    ( (void) ( p ), (void) ( n ) )
+#  define gsl_UNPOISON_MEMORY_REGION_( p, n )  ( (void) ( p ), (void) ( n ) )
+# endif
+#endif
+
 #if defined( gsl_CONFIG_CONTRACT_VIOLATION_ASSERTS ) || gsl_DEVICE_CODE
 # include <cassert>
 #endif
@@ -1430,12 +1736,21 @@
 #endif
 
 #if defined( gsl_CONFIG_CONTRACT_VIOLATION_TERMINATES_WITH_STACKTRACE )
-# include <iostream>
-# ifdef __cpp_lib_stacktrace
-#  include <stacktrace>
-# else
-#  error gsl_CONFIG_CONTRACT_VIOLATION_TERMINATES_WITH_STACKTRACE: requires C++23 for std::stacktrace
-# endif
+# if gsl_CONFIG( RAW_STACKTRACE )
+#  if defined( __GLIBC__ ) || defined( __APPLE__ ) || defined( __FreeBSD__ )
+#   include <execinfo.h>  // for backtrace()
+#   include <dlfcn.h>     // for dladdr()
+#  else
+#   error gsl_CONFIG_RAW_STACKTRACE: backtrace() and dladdr() are not available for this platform
+#  endif
+# else // ! gsl_CONFIG( RAW_STACKTRACE )
+#  include <iostream>
+#  ifdef __cpp_lib_stacktrace
+#   include <stacktrace>
+#  else
+#   error gsl_CONFIG_CONTRACT_VIOLATION_TERMINATES_WITH_STACKTRACE: requires C++23 for std::stacktrace; define gsl_CONFIG_RAW_STACKTRACE=1 to print raw return addresses instead
+#  endif
+# endif // gsl_CONFIG( RAW_STACKTRACE )
 #endif
 
 // We have to keep some older compilers from taking the modern route even though they technically support C++20:
@@ -2078,6 +2393,268 @@ using std::shared_ptr;
 #define gsl_HAVE_OWNER_TEMPLATE     gsl_HAVE_ALIAS_TEMPLATE
 #define gsl_HAVE_OWNER_TEMPLATE_()  gsl_HAVE_OWNER_TEMPLATE
 
+// Leak tracking for owning pointers:
+//
+//     owner<Widget *> w = gsl_TRACK_OWNER( new Widget() );
+//     ...
+//     delete gsl_UNTRACK_OWNER( w );
+//
+// With gsl_CONFIG_TRACK_OWNERS=1, `gsl_TRACK_OWNER()` records the pointer and the source location in a lock-free registry, and
+// `gsl_UNTRACK_OWNER()` removes it; both return their argument. Otherwise, both macros expand to their argument.
+
+#if gsl_CONFIG( TRACK_OWNERS )
+
+namespace detail {
+
+// Open-addressing hash table split into shards, each of which is probed linearly. Slots are claimed with CAS and vacated
+// by writing a tombstone, so that probe sequences remain intact; tombstones are reused by later insertions.
+// The capacity is fixed rather than configurable: all translation units share the registry, so they must agree on its layout.
+class owner_registry
+{
+public:
+    static const std::size_t capacity = 65536;
+    static const std::size_t shard_count = 16;
+    static const std::size_t shard_size = capacity / shard_count;
+
+private:
+    struct entry
+    {
+        std::atomic< void const * > ptr;
+        std::atomic< char const * > file;
+        std::atomic< int > line;
+    };
+    struct alignas( 64 ) shard
+    {
+        std::atomic< std::size_t > live;
+        entry entries[ shard_size ];
+    };
+
+    shard shards_[ shard_count ];
+    std::atomic< std::size_t > dropped_;   // owners not recorded because a shard was full
+    std::atomic< std::size_t > unknown_;   // releases of owners which were not recorded
+
+    static void const * empty() gsl_noexcept { return gsl_nullptr; }
+    static void const * tombstone() gsl_noexcept { return reinterpret_cast< void const * >( std::uintptr_t( 1 ) ); }
+    static void const * reserved() gsl_noexcept { return reinterpret_cast< void const * >( std::uintptr_t( 2 ) ); }
+
+    static std::size_t
+    hash( void const * p ) gsl_noexcept
+    {
+        return static_cast< std::size_t >( ( static_cast< std::uint64_t >( reinterpret_cast< std::uintptr_t >( p ) >> 4 ) * 0x9E3779B97F4A7C15ull ) >> 32 );
+    }
+
+    static void
+    report_at_exit()
+    {
+        instance()->report( stderr );
+    }
+
+    static owner_registry *
+    create() gsl_noexcept
+    {
+        void * storage = std::malloc( sizeof( owner_registry ) );
+        if ( storage == gsl_nullptr )
+        {
+            std::fputs( "gsl-lite: owner tracking is disabled because the registry could not be allocated\n", stderr );
+            return gsl_nullptr;
+        }
+        return ::new( storage ) owner_registry();
+    }
+
+public:
+    // The registry is never destroyed, so owners can be released during static destruction. If it cannot be allocated,
+    // a null pointer is returned, and owners are not tracked.
+    static owner_registry *
+    instance() gsl_noexcept
+    {
+        static owner_registry * registry = create();
+        return registry;
+    }
+
+    owner_registry() gsl_noexcept
+    : dropped_( 0 ), unknown_( 0 )
+    {
+        for ( std::size_t i = 0; i != shard_count; ++i )
+        {
+            shards_[ i ].live.store( 0, std::memory_order_relaxed );
+            for ( std::size_t j = 0; j != shard_size; ++j )
+            {
+                shards_[ i ].entries[ j ].ptr.store( empty(), std::memory_order_relaxed );
+                shards_[ i ].entries[ j ].file.store( gsl_nullptr, std::memory_order_relaxed );
+                shards_[ i ].entries[ j ].line.store( 0, std::memory_order_relaxed );
+            }
+        }
+        std::atexit( &report_at_exit );
+    }
+
+    void
+    track( void const * p, char const * file, int line ) gsl_noexcept
+    {
+        if ( p == gsl_nullptr )
+        {
+            return;
+        }
+        std::size_t const h = hash( p );
+        shard & s = shards_[ h % shard_count ];
+        for ( std::size_t i = 0, j = h / shard_count % shard_size; i != shard_size; ++i, j = j + 1 != shard_size ? j + 1 : 0 )
+        {
+            entry & e = s.entries[ j ];
+            void const * v = e.ptr.load( std::memory_order_relaxed );
+            if ( ( v == empty() || v == tombstone() ) && e.ptr.compare_exchange_strong( v, reserved(), std::memory_order_acquire ) )
+            {
+                e.file.store( file, std::memory_order_relaxed );
+                e.line.store( line, std::memory_order_relaxed );
+                e.ptr.store( p, std::memory_order_release );
+                s.live.fetch_add( 1, std::memory_order_relaxed );
+                return;
+            }
+        }
+        dropped_.fetch_add( 1, std::memory_order_relaxed );
+    }
+    void
+    untrack( void const * p ) gsl_noexcept
+    {
+        if ( p == gsl_nullptr )
+        {
+            return;
+        }
+        std::size_t const h = hash( p );
+        shard & s = shards_[ h % shard_count ];
+        for ( std::size_t i = 0, j = h / shard_count % shard_size; i != shard_size; ++i, j = j + 1 != shard_size ? j + 1 : 0 )
+        {
+            entry & e = s.entries[ j ];
+            void const * v = e.ptr.load( std::memory_order_relaxed );
+            if ( v == p )
+            {
+                e.ptr.store( tombstone(), std::memory_order_release );
+                s.live.fetch_sub( 1, std::memory_order_relaxed );
+                return;
+            }
+            if ( v == empty() )
+            {
+                break;
+            }
+        }
+        unknown_.fetch_add( 1, std::memory_order_relaxed );
+    }
+
+    gsl_NODISCARD std::size_t
+    live_count() const gsl_noexcept
+    {
+        std::size_t result = 0;
+        for ( std::size_t i = 0; i != shard_count; ++i )
+        {
+            result += shards_[ i ].live.load( std::memory_order_relaxed );
+        }
+        return result;
+    }
+
+    // Calls `f( p, file, line )` for every recorded owner. Owners which are tracked or released concurrently may be missed.
+    template< class F >
+    void
+    for_each( F f ) const
+    {
+        for ( std::size_t i = 0; i != shard_count; ++i )
+        {
+            for ( std::size_t j = 0; j != shard_size; ++j )
+            {
+                entry const & e = shards_[ i ].entries[ j ];
+                void const * p = e.ptr.load( std::memory_order_acquire );
+                if ( p == empty() || p == tombstone() || p == reserved() )
+                {
+                    continue;
+                }
+                char const * file = e.file.load( std::memory_order_relaxed );
+                int line = e.line.load( std::memory_order_relaxed );
+                if ( e.ptr.load( std::memory_order_acquire ) == p )
+                {
+                    f( p, file, line );
+                }
+            }
+        }
+    }
+
+    std::size_t
+    report( std::FILE * stream ) const
+    {
+        std::size_t count = 0;
+        for_each( [ stream, &count ]( void const * p, char const * file, int line )
+        {
+            std::fprintf( stream, "gsl-lite: owner %p allocated at %s:%d is still alive\n", p, file, line );
+            ++count;
+        } );
+        std::size_t const dropped = dropped_.load( std::memory_order_relaxed );
+        std::size_t const unknown = unknown_.load( std::memory_order_relaxed );
+        if ( dropped != 0 )
+        {
+            std::fprintf( stream, "gsl-lite: %lu owners were not tracked because the registry was full\n", static_cast< unsigned long >( dropped ) );
+        }
+        if ( unknown != 0 )
+        {
+            std::fprintf( stream, "gsl-lite: %lu owners were released which had not been tracked\n", static_cast< unsigned long >( unknown ) );
+        }
+        std::fflush( stream );
+        return count;
+    }
+};
+
+template< class T >
+inline T *
+track_owner( T * p, char const * file, int line ) gsl_noexcept
+{
+    if ( owner_registry * registry = owner_registry::instance() )
+    {
+        registry->track( p, file, line );
+    }
+    return p;
+}
+template< class T >
+inline T *
+untrack_owner( T * p ) gsl_noexcept
+{
+    if ( owner_registry * registry = owner_registry::instance() )
+    {
+        registry->untrack( p );
+    }
+    return p;
+}
+
+} // namespace detail
+
+// Returns the number of tracked owners which have not been released.
+gsl_NODISCARD inline std::size_t
+live_owner_count() gsl_noexcept
+{
+    detail::owner_registry const * registry = detail::owner_registry::instance();
+    return registry != gsl_nullptr ? registry->live_count() : 0;
+}
+
+// Calls `f( void const * p, char const * file, int line )` for every tracked owner which has not been released.
+template< class F >
+inline void
+for_each_live_owner( F f )
+{
+    if ( detail::owner_registry const * registry = detail::owner_registry::instance() )
+    {
+        registry->for_each( f );
+    }
+}
+
+// Prints all tracked owners which have not been released and returns their number. This also happens at exit.
+inline std::size_t
+report_live_owners( std::FILE * stream = stderr )
+{
+    detail::owner_registry const * registry = detail::owner_registry::instance();
+    return registry != gsl_nullptr ? registry->report( stream ) : 0;
+}
+
+# define gsl_TRACK_OWNER( p )    ( ::gsl_lite::detail::track_owner( ( p ), __FILE__, __LINE__ ) )
+# define gsl_UNTRACK_OWNER( p )  ( ::gsl_lite::detail::untrack_owner( p ) )
+#else // ! gsl_CONFIG( TRACK_OWNERS )
+# define gsl_TRACK_OWNER( p )    ( p )
+# define gsl_UNTRACK_OWNER( p )  ( p )
+#endif // gsl_CONFIG( TRACK_OWNERS )
+
 //
 // GSL.assert: assertions
 //
@@ -2125,21 +2702,22 @@ using std::shared_ptr;
 # endif
 # define   gsl_TRAP_FALLBACK_()  gsl_TRAP_()
 #else // host code
-# if defined( gsl_CONFIG_UNENFORCED_CONTRACTS_ASSUME )
-#  if gsl_COMPILER_MSVC_VERSION >= 140
-#   define  gsl_ASSUME_( x )           __assume( x )
-#   define  gsl_ASSUME_UNREACHABLE_()  __assume( 0 )
-#  elif gsl_COMPILER_GNUC_VERSION
+    // `gsl_ASSUME_()` is defined whenever the compiler supports UB optimization hints, because tagged contract checks may be
+    // assumed to hold even if `gsl_CONFIG_UNENFORCED_CONTRACTS_ASSUME` is not defined.
+# if gsl_COMPILER_MSVC_VERSION >= 140
+#  define   gsl_ASSUME_( x )           __assume( x )
+#  define   gsl_ASSUME_UNREACHABLE_()  __assume( 0 )
+# elif gsl_COMPILER_GNUC_VERSION
+#  define   gsl_ASSUME_( x )           ( ( x ) ? static_cast<void>(0) : __builtin_unreachable() )
+#  define   gsl_ASSUME_UNREACHABLE_()  __builtin_unreachable()
+# elif defined(__has_builtin)
+#  if __has_builtin(__builtin_unreachable)
 #   define  gsl_ASSUME_( x )           ( ( x ) ? static_cast<void>(0) : __builtin_unreachable() )
 #   define  gsl_ASSUME_UNREACHABLE_()  __builtin_unreachable()
-#  elif defined(__has_builtin)
-#   if __has_builtin(__builtin_unreachable)
-#    define gsl_ASSUME_( x )           ( ( x ) ? static_cast<void>(0) : __builtin_unreachable() )
-#    define gsl_ASSUME_UNREACHABLE_()  __builtin_unreachable()
-#   else
-#    error  gsl_CONFIG_UNENFORCED_CONTRACTS_ASSUME: gsl-lite does not know how to generate UB optimization hints for this compiler; use gsl_CONFIG_UNENFORCED_CONTRACTS_ELIDE instead
-#   endif
-#  else
+#  endif
+# endif
+# if defined( gsl_CONFIG_UNENFORCED_CONTRACTS_ASSUME )
+#  if !defined( gsl_ASSUME_ )
 #   error   gsl_CONFIG_UNENFORCED_CONTRACTS_ASSUME: gsl-lite does not know how to generate UB optimization hints for this compiler; use gsl_CONFIG_UNENFORCED_CONTRACTS_ELIDE instead
 #  endif
 #  define   gsl_CONTRACT_UNENFORCED_( x )  gsl_ASSUME_( x )
@@ -2302,48 +2880,66 @@ using std::shared_ptr;
 
 #if gsl_CHECK_CONTRACTS_ && !defined( gsl_CONFIG_CONTRACT_CHECKING_EXPECTS_OFF )
 # define  gsl_Expects( x )       gsl_CONTRACT_CHECK_MSG_( "precondition", x )
+# define  gsl_ExpectsAll( range, pred )       gsl_CONTRACT_CHECK_ALL_( "precondition", range, pred )
 #else
 # define  gsl_Expects( x )       gsl_CONTRACT_UNENFORCED_( x )
+# define  gsl_ExpectsAll( range, pred )       gsl_CONTRACT_UNENFORCED_( ::gsl_lite::all_of( range, pred ) )
 #endif
 #if gsl_CHECK_DEBUG_CONTRACTS_ && !defined( gsl_CONFIG_CONTRACT_CHECKING_EXPECTS_OFF )
 # define  gsl_ExpectsDebug( x )  gsl_CONTRACT_CHECK_MSG_( "precondition", x )
+# define  gsl_ExpectsAllDebug( range, pred )  gsl_CONTRACT_CHECK_ALL_( "precondition", range, pred )
 #else
 # define  gsl_ExpectsDebug( x )  gsl_ELIDE_( x )
+# define  gsl_ExpectsAllDebug( range, pred )  gsl_ELIDE_( ::gsl_lite::all_of( range, pred ) )
 #endif
 #if gsl_CHECK_AUDIT_CONTRACTS_ && !defined( gsl_CONFIG_CONTRACT_CHECKING_EXPECTS_OFF )
 # define  gsl_ExpectsAudit( x )  gsl_CONTRACT_CHECK_MSG_( "precondition", x )
+# define  gsl_ExpectsAllAudit( range, pred )  gsl_CONTRACT_CHECK_ALL_( "precondition", range, pred )
 #else
 # define  gsl_ExpectsAudit( x )  gsl_ELIDE_( x )
+# define  gsl_ExpectsAllAudit( range, pred )  gsl_ELIDE_( ::gsl_lite::all_of( range, pred ) )
 #endif
 #if gsl_CHECK_CONTRACTS_ && !defined( gsl_CONFIG_CONTRACT_CHECKING_ENSURES_OFF )
 # define  gsl_Ensures( x )       gsl_CONTRACT_CHECK_MSG_( "postcondition", x )
+# define  gsl_EnsuresAll( range, pred )       gsl_CONTRACT_CHECK_ALL_( "postcondition", range, pred )
 #else
 # define  gsl_Ensures( x )       gsl_CONTRACT_UNENFORCED_( x )
+# define  gsl_EnsuresAll( range, pred )       gsl_CONTRACT_UNENFORCED_( ::gsl_lite::all_of( range, pred ) )
 #endif
 #if gsl_CHECK_DEBUG_CONTRACTS_ && !defined( gsl_CONFIG_CONTRACT_CHECKING_ENSURES_OFF )
 # define  gsl_EnsuresDebug( x )  gsl_CONTRACT_CHECK_MSG_( "postcondition", x )
+# define  gsl_EnsuresAllDebug( range, pred )  gsl_CONTRACT_CHECK_ALL_( "postcondition", range, pred )
 #else
 # define  gsl_EnsuresDebug( x )  gsl_ELIDE_( x )
+# define  gsl_EnsuresAllDebug( range, pred )  gsl_ELIDE_( ::gsl_lite::all_of( range, pred ) )
 #endif
 #if gsl_CHECK_AUDIT_CONTRACTS_ && !defined( gsl_CONFIG_CONTRACT_CHECKING_ENSURES_OFF )
 # define  gsl_EnsuresAudit( x )  gsl_CONTRACT_CHECK_MSG_( "postcondition", x )
+# define  gsl_EnsuresAllAudit( range, pred )  gsl_CONTRACT_CHECK_ALL_( "postcondition", range, pred )
 #else
 # define  gsl_EnsuresAudit( x )  gsl_ELIDE_( x )
+# define  gsl_EnsuresAllAudit( range, pred )  gsl_ELIDE_( ::gsl_lite::all_of( range, pred ) )
 #endif
 #if gsl_CHECK_CONTRACTS_ && !defined( gsl_CONFIG_CONTRACT_CHECKING_ASSERT_OFF )
 # define  gsl_Assert( x )        gsl_CONTRACT_CHECK_( x )
+# define  gsl_AssertAll( range, pred )        gsl_CONTRACT_CHECK_ALL_( "", range, pred )
 #else
 # define  gsl_Assert( x )        gsl_CONTRACT_UNENFORCED_( x )
+# define  gsl_AssertAll( range, pred )        gsl_CONTRACT_UNENFORCED_( ::gsl_lite::all_of( range, pred ) )
 #endif
 #if gsl_CHECK_DEBUG_CONTRACTS_ && !defined( gsl_CONFIG_CONTRACT_CHECKING_ASSERT_OFF )
 # define  gsl_AssertDebug( x )   gsl_CONTRACT_CHECK_( x )
+# define  gsl_AssertAllDebug( range, pred )   gsl_CONTRACT_CHECK_ALL_( "", range, pred )
 #else
 # define  gsl_AssertDebug( x )   gsl_ELIDE_( x )
+# define  gsl_AssertAllDebug( range, pred )   gsl_ELIDE_( ::gsl_lite::all_of( range, pred ) )
 #endif
 #if gsl_CHECK_AUDIT_CONTRACTS_ && !defined( gsl_CONFIG_CONTRACT_CHECKING_ASSERT_OFF )
 # define  gsl_AssertAudit( x )   gsl_CONTRACT_CHECK_( x )
+# define  gsl_AssertAllAudit( range, pred )   gsl_CONTRACT_CHECK_ALL_( "", range, pred )
 #else
 # define  gsl_AssertAudit( x )   gsl_ELIDE_( x )
+# define  gsl_AssertAllAudit( range, pred )   gsl_ELIDE_( ::gsl_lite::all_of( range, pred ) )
 #endif
 #if gsl_CHECK_CONTRACTS_ && !defined( gsl_CONFIG_CONTRACT_CHECKING_ASSERT_OFF )
 # define  gsl_Verify( x )        gsl_CONTRACT_VERIFY_( x )
@@ -2352,6 +2948,13 @@ using std::shared_ptr;
 #endif
 #define   gsl_FailFast()         gsl_FAILFAST_()
 
+#if gsl_DEVICE_CODE
+# define  gsl_CONTRACT_CHECK_ALL_( str, range, pred )  gsl_CONTRACT_CHECK_MSG_( str, ::gsl_lite::all_of( range, pred ) )
+#else
+    // The range and the predicate are evaluated once; the index of the first failing element is passed to the violation handler.
+# define  gsl_CONTRACT_CHECK_ALL_( str, range, pred )  ::gsl_lite::detail::check_all_of< ::gsl_lite::default_contract_traits >( ::gsl_lite::detail::first_failing_index( range, pred ), "::gsl_lite::all_of( " #range ", " #pred " )", str, __FILE__, __LINE__ )
+#endif
+
 #ifdef __cpp_lib_source_location
 # if gsl_CHECK_CONTRACTS_ && !defined( gsl_CONFIG_CONTRACT_CHECKING_ASSERT_OFF )
 #  define gsl_AssertAt( loc, x )        gsl_CONTRACT_CHECK_AT_( loc, x )
@@ -2376,19 +2979,185 @@ using std::shared_ptr;
 # define  gsl_FailFastAt( loc )        gsl_FAILFAST_AT_( loc )
 #endif // __cpp_lib_source_location
 
-#undef gsl_CHECK_CONTRACTS_
+    // Contract checks tagged with a component tag are configured with `contract_traits<>`.
+#if defined( gsl_ASSUME_ )
+# define  gsl_CONTRACT_ASSUME_TAGGED_( x )  gsl_ASSUME_( x )
+#else
+# define  gsl_CONTRACT_ASSUME_TAGGED_( x )  gsl_NO_OP_()
+#endif
+#define   gsl_CONTRACT_CHECK_TAGGED_( tag, level, str, x ) \
+    ( gsl_DIAG_SUPPRESS_236_ ::gsl_lite::contract_traits< tag >::checking_level >= level \
+        ? ( ( x ) ? static_cast<void>(0) : ::gsl_lite::contract_traits< tag >::handle_violation( #x, str, __FILE__, __LINE__ ) ) \
+        : ( level == ::gsl_lite::contract_checking_level::on && ::gsl_lite::contract_traits< tag >::assumes_unenforced \
+            ? gsl_CONTRACT_ASSUME_TAGGED_( x ) \
+            : static_cast<void>(0) ) gsl_DIAG_RESTORE_236_ )
+#define   gsl_ExpectsTagged( tag, x )       gsl_CONTRACT_CHECK_TAGGED_( tag, ::gsl_lite::contract_checking_level::on,    "precondition", x )
+#define   gsl_ExpectsTaggedDebug( tag, x )  gsl_CONTRACT_CHECK_TAGGED_( tag, ::gsl_lite::contract_checking_level::debug, "precondition", x )
+#define   gsl_ExpectsTaggedAudit( tag, x )  gsl_CONTRACT_CHECK_TAGGED_( tag, ::gsl_lite::contract_checking_level::audit, "precondition", x )
+#define   gsl_EnsuresTagged( tag, x )       gsl_CONTRACT_CHECK_TAGGED_( tag, ::gsl_lite::contract_checking_level::on,    "postcondition", x )
+#define   gsl_EnsuresTaggedDebug( tag, x )  gsl_CONTRACT_CHECK_TAGGED_( tag, ::gsl_lite::contract_checking_level::debug, "postcondition", x )
+#define   gsl_EnsuresTaggedAudit( tag, x )  gsl_CONTRACT_CHECK_TAGGED_( tag, ::gsl_lite::contract_checking_level::audit, "postcondition", x )
+#define   gsl_AssertTagged( tag, x )        gsl_CONTRACT_CHECK_TAGGED_( tag, ::gsl_lite::contract_checking_level::on,    "", x )
+#define   gsl_AssertTaggedDebug( tag, x )   gsl_CONTRACT_CHECK_TAGGED_( tag, ::gsl_lite::contract_checking_level::debug, "", x )
+#define   gsl_AssertTaggedAudit( tag, x )   gsl_CONTRACT_CHECK_TAGGED_( tag, ::gsl_lite::contract_checking_level::audit, "", x )
+
+#if gsl_CHECK_AUDIT_CONTRACTS_
+# define  gsl_CONTRACT_CHECKING_LEVEL_  ::gsl_lite::contract_checking_level::audit
+#elif gsl_CHECK_DEBUG_CONTRACTS_
+# define  gsl_CONTRACT_CHECKING_LEVEL_  ::gsl_lite::contract_checking_level::debug
+#elif gsl_CHECK_CONTRACTS_
+# define  gsl_CONTRACT_CHECKING_LEVEL_  ::gsl_lite::contract_checking_level::on
+#else
+# define  gsl_CONTRACT_CHECKING_LEVEL_  ::gsl_lite::contract_checking_level::off
+#endif
+
+#undef gsl_CHECK_CONTRACTS_
 #undef gsl_CHECK_DEBUG_CONTRACTS_
 #undef gsl_CHECK_AUDIT_CONTRACTS_
 
 
+namespace detail {
+
+inline std::size_t append_to_buffer( char * buffer, std::size_t pos, std::size_t size, char const * str ) gsl_noexcept
+{
+    while ( pos + 1 < size && *str != '\0' )
+    {
+        buffer[ pos++ ] = *str++;
+    }
+    buffer[ pos ] = '\0';
+    return pos;
+}
+inline std::size_t append_to_buffer( char * buffer, std::size_t pos, std::size_t size, std::size_t value ) gsl_noexcept
+{
+    // Simple base-10 conversion; we cannot use `std::to_string()` or `sprintf()` without allocating or locking.
+    char digits[ 3 * sizeof( std::size_t ) + 1 ];
+    char * p = digits + sizeof digits;
+    *--p = '\0';
+    do
+    {
+        *--p = static_cast<char>( '0' + value % 10 );
+        value /= 10;
+    } while ( value != 0 );
+    return detail::append_to_buffer( buffer, pos, size, p );
+}
+
+// Appends the message of a contract violation, followed by " violated by element <index>" unless the index is `std::size_t( -1 )`.
+inline std::size_t append_contract_message( char * buffer, std::size_t pos, std::size_t size, char const * message, std::size_t index ) gsl_noexcept
+{
+    pos = detail::append_to_buffer( buffer, pos, size, message );
+    if ( index != static_cast<std::size_t>( -1 ) )
+    {
+        pos = detail::append_to_buffer( buffer, pos, size, message[0] != '\0' ? " violated by element " : "violated by element " );
+        pos = detail::append_to_buffer( buffer, pos, size, index );
+    }
+    return pos;
+}
+
+// Formats "assertion failed: `message: expression' at file:line" into the given buffer, truncating if necessary.
+inline char const * format_contract_violation( char * buffer, std::size_t size, char const * expression, char const * message, char const * file, unsigned line, std::size_t index ) gsl_noexcept
+{
+    std::size_t pos = 0;
+    pos = detail::append_to_buffer( buffer, pos, size, "assertion failed: `" );
+    if ( message[0] != '\0' || index != static_cast<std::size_t>( -1 ) )
+    {
+        pos = detail::append_contract_message( buffer, pos, size, message, index );
+        pos = detail::append_to_buffer( buffer, pos, size, ": " );
+    }
+    pos = detail::append_to_buffer( buffer, pos, size, expression );
+    pos = detail::append_to_buffer( buffer, pos, size, "' at " );
+    pos = detail::append_to_buffer( buffer, pos, size, file );
+    pos = detail::append_to_buffer( buffer, pos, size, ":" );
+    static_cast<void>( detail::append_to_buffer( buffer, pos, size, line ) );
+    return buffer;
+}
+
+} // namespace detail
+
 struct fail_fast : public std::logic_error
 {
     explicit fail_fast( char const * message )
-    : std::logic_error( message ) {}
+    : std::logic_error( message )
+    , expression_( "" ), message_( "" ), file_( "" ), line_( 0 ), index_( static_cast<std::size_t>( -1 ) ), structured_( false )
+    {
+        what_[ 0 ] = '\0';
+    }
+
+        // Does not allocate. All strings must have static storage duration, as is the case for the arguments passed by
+        // the contract checking macros.
+        // The index of the first element violating the predicate of a range check such as `gsl_ExpectsAll()` may be passed
+        // as `index`; it defaults to `std::size_t( -1 )`.
+    fail_fast( char const * expression, char const * message, char const * file, unsigned line, std::size_t index = static_cast<std::size_t>( -1 ) )
+    : std::logic_error( "" )
+    , expression_( expression ), message_( message ? message : "" ), file_( file ), line_( line ), index_( index ), structured_( true )
+    {
+        detail::format_contract_violation( what_, sizeof what_, expression_, message_, file_, line_, index_ );
+    }
+
+    char const * expression()    const gsl_noexcept { return expression_; }
+    char const * message()       const gsl_noexcept { return message_; }
+    char const * file_name()     const gsl_noexcept { return file_; }
+    unsigned     line()          const gsl_noexcept { return line_; }
+    std::size_t  element_index() const gsl_noexcept { return index_; }
+
+        // The message is formatted into a buffer owned by the exception object, so the pointer returned remains valid for
+        // the lifetime of the object. Overly long messages are truncated.
+    char const * what() const gsl_noexcept
+#if gsl_HAVE( OVERRIDE_FINAL )
+    override
+#endif
+    {
+        if ( ! structured_ )
+        {
+            return std::logic_error::what();
+        }
+        return what_;
+    }
+
+private:
+    char const * expression_;
+    char const * message_;
+    char const * file_;
+    unsigned     line_;
+    std::size_t  index_;
+    bool         structured_;
+    char         what_[ 1024 ];
 };
 
 namespace detail {
 
+#if gsl_WRITES_TO_STDERR_
+inline std::size_t append_hex_to_buffer( char * buffer, std::size_t pos, std::size_t size, std::size_t value ) gsl_noexcept
+{
+    char digits[ 2 * sizeof( std::size_t ) + 1 ];
+    char * p = digits + sizeof digits;
+    *--p = '\0';
+    do
+    {
+        *--p = "0123456789abcdef"[ value % 16 ];
+        value /= 16;
+    } while ( value != 0 );
+    return detail::append_to_buffer( buffer, pos, size, p );
+}
+    // Writes directly to the standard error stream, bypassing stdio buffering and locking.
+inline void write_to_stderr( char const * buffer, std::size_t size ) gsl_noexcept
+{
+    while ( size != 0 )
+    {
+# if defined( _WIN32 )
+        int n = ::_write( 2, buffer, static_cast<unsigned>( size ) );
+# else
+        long n = static_cast<long>( ::write( STDERR_FILENO, buffer, size ) );
+# endif
+        if ( n < 0 )
+        {
+            if ( errno == EINTR ) continue;
+            return;
+        }
+        buffer += n;
+        size -= static_cast<std::size_t>( n );
+    }
+}
+#endif // gsl_WRITES_TO_STDERR_
 #if defined( gsl_CONFIG_CONTRACT_VIOLATION_ASSERTS )
 # if gsl_CONFIG( USE_CRT_ASSERTION_HANDLER )
 #  if gsl_COMPILER_MS_STL_VERSION && ! defined( _DEBUG )
@@ -2411,6 +3180,36 @@ extern "C" void __assert_fail( char const * expr, char const * file, unsigned li
 extern "C" void __assert( char const * expr, char const * file, int line );
 #  endif
 # endif // gsl_CONFIG( USE_CRT_ASSERTION_HANDLER )
+# if gsl_CONFIG( USE_SIGNAL_SAFE_ASSERTION_HANDLER )
+    // Async-signal-safe: formats the message into a stack buffer and writes it with a single system call, without allocating
+    // memory or touching the locale. Can thus be used from signal handlers and when the heap is corrupted.
+inline void write_contract_violation( char const * expression, char const * message, char const * filename, unsigned line ) gsl_noexcept
+{
+    char buffer[ 1024 ];
+        // `append_to_buffer()` always leaves room for a null terminator. The closing quote is appended after truncating the
+        // message to one byte less, and the trailing newline takes the place of the null terminator, so it is never dropped.
+    std::size_t const size = sizeof buffer - 1;
+    std::size_t pos = 0;
+    pos = detail::append_to_buffer( buffer, pos, size, filename );
+    pos = detail::append_to_buffer( buffer, pos, size, ":" );
+    pos = detail::append_to_buffer( buffer, pos, size, line );
+    pos = detail::append_to_buffer( buffer, pos, size, ": Assertion failed: `" );
+    if ( message && message[0] != '\0' )
+    {
+        pos = detail::append_to_buffer( buffer, pos, size, message );
+        pos = detail::append_to_buffer( buffer, pos, size, ": " );
+    }
+    pos = detail::append_to_buffer( buffer, pos, size, expression );
+    pos = detail::append_to_buffer( buffer, pos, sizeof buffer, "'" );
+    buffer[ pos++ ] = '\n';
+    detail::write_to_stderr( buffer, pos );
+#  if gsl_CONFIG( SIGNAL_SAFE_ASSERTION_HANDLER_PRINTS_BACKTRACE )
+    void * frames[ 64 ];
+    int numFrames = ::backtrace( frames, static_cast<int>( sizeof frames / sizeof frames[0] ) );
+    ::backtrace_symbols_fd( frames, numFrames, STDERR_FILENO );
+#  endif
+}
+# endif // gsl_CONFIG( USE_SIGNAL_SAFE_ASSERTION_HANDLER )
 # if ! gsl_COMPILER_MS_STL_VERSION || ! defined( _DEBUG )
 gsl_NORETURN
 #  if defined( _MSC_VER )
@@ -2444,7 +3243,9 @@ inline void fail_fast_assert( char const * expression, char const * message, cha
 #    endif
     }
 #   endif
-#  else // ! gsl_CONFIG( USE_CRT_ASSERTION_HANDLER )
+#  elif gsl_CONFIG( USE_SIGNAL_SAFE_ASSERTION_HANDLER )
+    detail::write_contract_violation( expression, message, filename, line );
+#  else // ! gsl_CONFIG( USE_CRT_ASSERTION_HANDLER ) && ! gsl_CONFIG( USE_SIGNAL_SAFE_ASSERTION_HANDLER )
     bool haveMessage = message && message[0] != '\0';
     std::fprintf( stderr,
         haveMessage ? "%s:%u: Assertion failed: `%s: %s'\n" : "%s:%u: Assertion failed: `%s%s'\n",
@@ -2462,40 +3263,11 @@ __declspec( noinline )
 # elif defined( __GNUC__ )
 __attribute__(( noinline ))
 # endif
-inline void fail_fast_throw( char const * expression, char const * message, char const * filename, unsigned line )
+inline void fail_fast_throw( char const * expression, char const * message, char const * filename, unsigned line, std::size_t index = static_cast<std::size_t>( -1 ) )
 {
-    // At the expense of having to assemble the string at runtime, we avoid bloating the executable by keeping filename and message strings separate.
-    std::string s = "assertion failed: `";
-    if ( message && message[0] )
-    {
-        s += message;
-        s += ": ";
-    }
-    s += expression;
-    s += "' at ";
-    s += filename;
-    s += ":";
-#if gsl_CPP11_110
-    s += std::to_string( line );
-#else
-    // The C++98 standard library offers no reasonable way to convert an integer to a string.
-    // We'd rather avoid calling `sprintf()`, so we implement simple base-10 conversion here.
-    std::string::size_type pos = s.length();
-    if ( line == 0 )
-    {
-        s += '0';
-    }
-    else
-    {
-        while ( line != 0 )
-        {
-            unsigned digit = line % 10;
-            line /= 10;
-            s.insert( pos, 1, static_cast<char>( '0' + digit ) );
-        }
-    }
-#endif
-    throw fail_fast( s.c_str() );
+    // We avoid bloating the executable by keeping filename and message strings separate; the exception message is
+    // assembled by the `fail_fast` constructor.
+    throw fail_fast( expression, message, filename, line, index );
 }
 #endif // defined( gsl_CONFIG_CONTRACT_VIOLATION_THROWS )
 #if defined( gsl_CONFIG_CONTRACT_VIOLATION_TERMINATES_WITH_STACKTRACE )
@@ -2507,6 +3279,53 @@ __attribute__(( noinline ))
 # endif
 inline void fail_fast_trace( char const * expression, char const * message ) gsl_noexcept
 {
+# if gsl_CONFIG( RAW_STACKTRACE )
+    // Symbolization is deferred: we only print the return addresses as offsets relative to the base address of the module
+    // they belong to. The offsets can be symbolized offline, e.g. with `addr2line -f -C -e <module> <offset>...`.
+    char buffer[ 1024 ];
+    std::size_t pos = 0;
+    pos = detail::append_to_buffer( buffer, pos, sizeof buffer, "assertion failed: " );
+    if ( message && message[0] )
+    {
+        pos = detail::append_to_buffer( buffer, pos, sizeof buffer, message );
+        pos = detail::append_to_buffer( buffer, pos, sizeof buffer, ": " );
+    }
+    pos = detail::append_to_buffer( buffer, pos, sizeof buffer, "`" );
+    pos = detail::append_to_buffer( buffer, pos, sizeof buffer - 6, expression );  // leave room for the trailing "' at:\n"
+    pos = detail::append_to_buffer( buffer, pos, sizeof buffer, "' at:\n" );
+    detail::write_to_stderr( buffer, pos );
+
+    void * frames[ 64 ];
+    int numFrames = ::backtrace( frames, static_cast<int>( sizeof frames / sizeof frames[0] ) );
+    int skip;
+#  if defined( __GNUC__ )
+    skip = 1;  // the function has a noinline attribute, so we can skip it in the call stack
+#  else
+    skip = 0;  // don't know how to generate a noinline attribute for this compiler, so play it safe
+#  endif
+    for ( int i = skip; i < numFrames; ++i )
+    {
+        pos = 0;
+        pos = detail::append_to_buffer( buffer, pos, sizeof buffer, "  #" );
+        pos = detail::append_to_buffer( buffer, pos, sizeof buffer, static_cast<unsigned>( i - skip ) );
+        pos = detail::append_to_buffer( buffer, pos, sizeof buffer, " " );
+        std::size_t address = reinterpret_cast<std::size_t>( frames[ i ] );
+        Dl_info info;
+        if ( ::dladdr( frames[ i ], &info ) != 0 && info.dli_fname != gsl_nullptr )
+        {
+            pos = detail::append_to_buffer( buffer, pos, sizeof buffer - 24, info.dli_fname );  // leave room for the offset
+            pos = detail::append_to_buffer( buffer, pos, sizeof buffer, "+0x" );
+            pos = detail::append_hex_to_buffer( buffer, pos, sizeof buffer, address - reinterpret_cast<std::size_t>( info.dli_fbase ) );
+        }
+        else
+        {
+            pos = detail::append_to_buffer( buffer, pos, sizeof buffer, "?? 0x" );
+            pos = detail::append_hex_to_buffer( buffer, pos, sizeof buffer, address );
+        }
+        pos = detail::append_to_buffer( buffer, pos, sizeof buffer, "\n" );
+        detail::write_to_stderr( buffer, pos );
+    }
+# else // ! gsl_CONFIG( RAW_STACKTRACE )
     std::cerr << "assertion failed: ";
     if ( message && message[0] )
     {
@@ -2520,6 +3339,7 @@ inline void fail_fast_trace( char const * expression, char const * message ) gsl
     skip = 0;  // don't know how to generate a noinline attribute for this compiler, so play it safe
 # endif
     std::cerr << std::stacktrace::current( skip ) << std::endl;
+# endif // gsl_CONFIG( RAW_STACKTRACE )
     std::terminate();
 }
 #endif // defined( gsl_CONFIG_CONTRACT_VIOLATION_TERMINATES_WITH_STACKTRACE )
@@ -2537,6 +3357,153 @@ gsl_NORETURN inline void fail_fast_abort() gsl_noexcept
 // Should be defined by user
 gsl_api void fail_fast_assert_handler( char const * expression, char const * message, char const * file, int line );
 
+//
+// contract_traits<> - Per-component contract checking configuration for `gsl_ExpectsTagged()` and friends.
+//
+
+struct contract_checking_level
+{
+    enum type
+    {
+        off   = 0,  // contract checks are not enforced
+        on    = 1,  // `gsl_*Tagged()` checks are enforced
+        debug = 2,  // `gsl_*Tagged()` and `gsl_*TaggedDebug()` checks are enforced
+        audit = 3   // all checks are enforced
+    };
+};
+
+    // Contract violation handlers for use with `basic_contract_traits<>`. Every handler has a name of its own, so components
+    // configured with different handlers can be linked together. A handler is available only if the functions it relies on
+    // are; `contract_violation_terminates`, `contract_violation_traps` and `contract_violation_calls_handler` always are.
+    // `handle_element_violation()` is called by range checks such as `gsl_ExpectsAll()` with the index of the first element
+    // violating the predicate.
+struct contract_violation_terminates
+{
+    gsl_NORETURN static void handle_violation( char const *, char const *, char const *, unsigned )
+    {
+        detail::fail_fast_terminate();
+    }
+    gsl_NORETURN static void handle_element_violation( char const *, char const *, char const *, unsigned, std::size_t )
+    {
+        detail::fail_fast_terminate();
+    }
+};
+struct contract_violation_traps
+{
+    gsl_NORETURN static void handle_violation( char const *, char const *, char const *, unsigned )
+    {
+        gsl_TRAP_FALLBACK_();
+    }
+    gsl_NORETURN static void handle_element_violation( char const *, char const *, char const *, unsigned, std::size_t )
+    {
+        gsl_TRAP_FALLBACK_();
+    }
+};
+struct contract_violation_calls_handler
+{
+    gsl_NORETURN static void handle_violation( char const * expression, char const * message, char const * file, unsigned line )
+    {
+        ::gsl_lite::fail_fast_assert_handler( expression, message, file, static_cast<int>( line ) );
+        gsl_TRAP_FALLBACK_();  // do not let the custom assertion handler continue execution
+    }
+        // The index is not reported: the user-defined handler may hold on to the message, so it must remain a string literal.
+    gsl_NORETURN static void handle_element_violation( char const * expression, char const * message, char const * file, unsigned line, std::size_t )
+    {
+        handle_violation( expression, message, file, line );
+    }
+};
+#if defined( gsl_CONFIG_CONTRACT_VIOLATION_THROWS )
+struct contract_violation_throws
+{
+    gsl_NORETURN static void handle_violation( char const * expression, char const * message, char const * file, unsigned line )
+    {
+        detail::fail_fast_throw( expression, message, file, line );
+    }
+        // The index is stored in the exception, cf. `fail_fast::element_index()`.
+    gsl_NORETURN static void handle_element_violation( char const * expression, char const * message, char const * file, unsigned line, std::size_t index )
+    {
+        detail::fail_fast_throw( expression, message, file, line, index );
+    }
+};
+#endif // defined( gsl_CONFIG_CONTRACT_VIOLATION_THROWS )
+#if defined( gsl_CONFIG_CONTRACT_VIOLATION_ASSERTS )
+struct contract_violation_asserts
+{
+    gsl_NORETURN static void handle_violation( char const * expression, char const * message, char const * file, unsigned line )
+    {
+# if gsl_CONFIG( USE_CRT_ASSERTION_HANDLER ) && gsl_COMPILER_MS_STL_VERSION && defined( _DEBUG )
+        if ( ::_CrtDbgReport( _CRT_ASSERT, file, static_cast<int>( line ), gsl_nullptr, "%s: `%s'", message, expression ) == 1 )
+        {
+            _CrtDbgBreak();
+        }
+        detail::fail_fast_abort();
+# else
+        detail::fail_fast_assert( expression, message, file, line );
+# endif
+    }
+        // The message is printed before `handle_violation()` returns, so it can be formatted into a buffer on the stack.
+    gsl_NORETURN static void handle_element_violation( char const * expression, char const * message, char const * file, unsigned line, std::size_t index )
+    {
+        char buffer[ 128 ];
+        static_cast<void>( detail::append_contract_message( buffer, 0, sizeof buffer, message, index ) );
+        handle_violation( expression, buffer, file, line );
+    }
+};
+#endif // defined( gsl_CONFIG_CONTRACT_VIOLATION_ASSERTS )
+#if defined( gsl_CONFIG_CONTRACT_VIOLATION_TERMINATES_WITH_STACKTRACE )
+struct contract_violation_terminates_with_stacktrace
+{
+    gsl_NORETURN static void handle_violation( char const * expression, char const * message, char const *, unsigned )
+    {
+        detail::fail_fast_trace( expression, message );
+    }
+    gsl_NORETURN static void handle_element_violation( char const * expression, char const * message, char const *, unsigned, std::size_t index )
+    {
+        char buffer[ 128 ];
+        static_cast<void>( detail::append_contract_message( buffer, 0, sizeof buffer, message, index ) );
+        detail::fail_fast_trace( expression, buffer );
+    }
+};
+#endif // defined( gsl_CONFIG_CONTRACT_VIOLATION_TERMINATES_WITH_STACKTRACE )
+
+    // Contract traits assembled from a checking level, the choice whether unenforced checks are assumed to hold, and a contract
+    // violation handler. All three are part of the name of the type.
+template< int CheckingLevel, bool AssumesUnenforced, class ViolationHandler >
+struct basic_contract_traits : ViolationHandler
+{
+    static const int checking_level = CheckingLevel;
+    static const bool assumes_unenforced = AssumesUnenforced;
+};
+
+#if defined( gsl_CONFIG_CONTRACT_VIOLATION_THROWS )
+# define  gsl_CONTRACT_VIOLATION_HANDLER_  ::gsl_lite::contract_violation_throws
+#elif defined( gsl_CONFIG_CONTRACT_VIOLATION_ASSERTS )
+# define  gsl_CONTRACT_VIOLATION_HANDLER_  ::gsl_lite::contract_violation_asserts
+#elif defined( gsl_CONFIG_CONTRACT_VIOLATION_TERMINATES_WITH_STACKTRACE )
+# define  gsl_CONTRACT_VIOLATION_HANDLER_  ::gsl_lite::contract_violation_terminates_with_stacktrace
+#elif defined( gsl_CONFIG_CONTRACT_VIOLATION_CALLS_HANDLER )
+# define  gsl_CONTRACT_VIOLATION_HANDLER_  ::gsl_lite::contract_violation_calls_handler
+#elif defined( gsl_CONFIG_CONTRACT_VIOLATION_TRAPS )
+# define  gsl_CONTRACT_VIOLATION_HANDLER_  ::gsl_lite::contract_violation_traps
+#else // defined( gsl_CONFIG_CONTRACT_VIOLATION_TERMINATES )
+# define  gsl_CONTRACT_VIOLATION_HANDLER_  ::gsl_lite::contract_violation_terminates
+#endif
+#if defined( gsl_CONFIG_UNENFORCED_CONTRACTS_ASSUME )
+# define  gsl_CONTRACT_ASSUMES_UNENFORCED_  true
+#else
+# define  gsl_CONTRACT_ASSUMES_UNENFORCED_  false
+#endif
+
+    // Contract traits reflecting the global contract checking configuration of the translation unit. The configuration is
+    // encoded in the template arguments, so translation units with different configurations refer to different types.
+typedef basic_contract_traits< gsl_CONTRACT_CHECKING_LEVEL_, gsl_CONTRACT_ASSUMES_UNENFORCED_, gsl_CONTRACT_VIOLATION_HANDLER_ > default_contract_traits;
+
+    // `contract_traits<>` must be specialized for every tag type used with `gsl_ExpectsTagged()` and friends, typically by
+    // deriving from `basic_contract_traits<>`. The primary template is deliberately left undefined: if it reflected the
+    // global configuration, translation units with different configurations would define it differently.
+template< class Tag >
+struct contract_traits;
+
 //
 // GSL.util: utilities
 //
@@ -3166,6 +4133,89 @@ at( span<T, Extent> s, size_t pos )
 
 #endif // gsl_USE_MODERN_IMPLEMENTATION_
 
+//
+// all_of() - Check whether a predicate holds for all elements of a range, used by `gsl_ExpectsAll()` and friends.
+//
+
+namespace detail {
+
+template< class It, class Pred >
+gsl_NODISCARD gsl_api gsl_constexpr14 inline bool
+all_of_( It first, It last, Pred & pred )
+{
+    // The results are accumulated without short-circuiting so that the loop is free of branches and can be vectorized.
+    unsigned result = 1;
+    for ( ; first != last; ++first )
+    {
+        result &= static_cast<unsigned>( static_cast<bool>( pred( *first ) ) );
+    }
+    return result != 0;
+}
+
+} // namespace detail
+
+template< class Range, class Pred >
+gsl_NODISCARD gsl_api gsl_constexpr14 inline bool
+all_of( Range const & range, Pred pred )
+{
+    return detail::all_of_( range.begin(), range.end(), pred );
+}
+
+template< class T, size_t N, class Pred >
+gsl_NODISCARD gsl_api gsl_constexpr14 inline bool
+all_of( T const (&arr)[N], Pred pred )
+{
+    return detail::all_of_( &arr[0], &arr[0] + N, pred );
+}
+
+namespace detail {
+
+    // Returns the index of the first element for which the predicate does not hold, or `std::size_t( -1 )` if it holds for
+    // all elements. Like `all_of_()`, the loop does not short-circuit: the smallest failing index is selected without
+    // branching, so the predicate is evaluated exactly once per element and the loop can be vectorized.
+template< class It, class Pred >
+gsl_NODISCARD gsl_api gsl_constexpr14 inline std::size_t
+first_failing_index_( It first, It last, Pred & pred )
+{
+    std::size_t result = static_cast<std::size_t>( -1 );
+    for ( std::size_t i = 0; first != last; ++first, ++i )
+    {
+        std::size_t const candidate = static_cast<bool>( pred( *first ) ) ? result : i;
+        result = candidate < result ? candidate : result;
+    }
+    return result;
+}
+
+template< class Range, class Pred >
+gsl_NODISCARD gsl_api gsl_constexpr14 inline std::size_t
+first_failing_index( Range const & range, Pred pred )
+{
+    return detail::first_failing_index_( range.begin(), range.end(), pred );
+}
+
+template< class T, size_t N, class Pred >
+gsl_NODISCARD gsl_api gsl_constexpr14 inline std::size_t
+first_failing_index( T const (&arr)[N], Pred pred )
+{
+    return detail::first_failing_index_( &arr[0], &arr[0] + N, pred );
+}
+
+#if ! gsl_DEVICE_CODE
+    // Used by `gsl_ExpectsAll()` and friends. The violation handler is taken from the contract traits, so the function body
+    // does not depend on the contract checking configuration.
+template< class Traits >
+inline void
+check_all_of( std::size_t index, char const * expression, char const * message, char const * file, unsigned line )
+{
+    if ( index != static_cast<std::size_t>( -1 ) )
+    {
+        Traits::handle_element_violation( expression, message, file, line, index );
+    }
+}
+#endif // ! gsl_DEVICE_CODE
+
+} // namespace detail
+
 //
 // GSL.views: views
 //
@@ -3189,6 +4239,12 @@ template< class T > constexpr bool is_nullable_v = is_nullable< T >::value;
 
 template< gsl_CONSTRAINT( nullable ) T >
 class not_null;
+template< gsl_CONSTRAINT( nullable ) T >
+class optional_not_null;
+template< class P >
+class scoped_borrow;
+template< class Signature >
+class not_null_function_ref;
 
 namespace detail {
 
@@ -3247,6 +4303,12 @@ template< class T >
 struct is_not_null_or_bool_oracle : std11::false_type { };
 template< class T >
 struct is_not_null_or_bool_oracle< not_null<T> > : std11::true_type { };
+template< class T >
+struct is_not_null_or_bool_oracle< optional_not_null<T> > : std11::true_type { };
+template< class T >
+struct is_not_null_or_bool_oracle< scoped_borrow<T> > : std11::true_type { };
+template< class T >
+struct is_not_null_or_bool_oracle< not_null_function_ref<T> > : std11::true_type { };
 template<>
 struct is_not_null_or_bool_oracle< bool > : std11::true_type { };
 #if gsl_CPP14_OR_GREATER
@@ -3383,6 +4445,8 @@ struct not_null_data< T, IsCopyable, true >
 template< class T >
 struct not_null_accessor;
 
+struct not_null_unchecked_tag { };
+
 #if gsl_BASELINE_CPP20_
 template< class T, bool HasElementType = has_element_type<T>::value >
 struct not_null_base
@@ -3452,6 +4516,25 @@ private:
     typedef detail::not_null_accessor<T> accessor;
 #endif // ! gsl_BASELINE_CPP20_
 
+    // Construction without a null check, for use by `detail::not_null_accessor<>::make_unchecked()` if the argument is known
+    // to be non-null.
+#if gsl_BASELINE_CPP20_
+    gsl_api constexpr not_null( T other, detail::not_null_unchecked_tag ) noexcept
+    : ptr_( std::move( other ) )
+    {
+    }
+#elif gsl_HAVE( MOVE_FORWARD )
+    gsl_api gsl_constexpr14 not_null( T other, detail::not_null_unchecked_tag ) gsl_noexcept
+    : data_( std::move( other ) )
+    {
+    }
+#else // a.k.a. ! gsl_HAVE( MOVE_FORWARD )
+    gsl_api gsl_constexpr14 not_null( T const & other, detail::not_null_unchecked_tag ) gsl_noexcept
+    : data_( other )
+    {
+    }
+#endif // gsl_BASELINE_CPP20_
+
 #if gsl_HAVE( TYPE_TRAITS )
     static_assert( ! std::is_reference<T>::value, "T may not be a reference type" );
     static_assert( ! std::is_const<T>::value && ! std::is_volatile<T>::value, "T may not be cv-qualified" );
@@ -4248,10 +5331,25 @@ template< class T >
 struct as_nullable_helper< not_null<T> >
 {
 };
+template< class T >
+struct as_nullable_helper< optional_not_null<T> >
+{
+};
 
 template< class T >
 struct not_null_accessor
 {
+#if gsl_HAVE( MOVE_FORWARD )
+    static gsl_api not_null<T> make_unchecked( T p ) gsl_noexcept
+    {
+        return not_null<T>( std::move( p ), not_null_unchecked_tag() );
+    }
+#else // ! gsl_HAVE( MOVE_FORWARD )
+    static gsl_api not_null<T> make_unchecked( T const & p ) gsl_noexcept
+    {
+        return not_null<T>( p, not_null_unchecked_tag() );
+    }
+#endif // gsl_HAVE( MOVE_FORWARD )
 #if gsl_BASELINE_CPP20_
     static gsl_api bool is_valid( not_null<T> const & p ) noexcept
     {
@@ -4292,6 +5390,10 @@ struct not_null_accessor
 template< class T >
 struct not_null_accessor< T * >
 {
+    static gsl_api not_null< T * > make_unchecked( T * p ) gsl_noexcept
+    {
+        return not_null< T * >( p, not_null_unchecked_tag() );
+    }
     static gsl_api T * const & get( not_null< T * > const & p ) gsl_noexcept
     {
         return p.data_.ptr_;
@@ -4377,6 +5479,20 @@ get( T * const & p )
     return p;
 }
 
+// `borrow()` checks the smart pointer once and returns a raw `not_null<>` pointer whose use requires no further checks.
+template< class P >
+gsl_NODISCARD gsl_api gsl_constexpr14 auto
+borrow( not_null<P> const & p ) -> not_null< typename std::remove_pointer< decltype( p.operator->().get() ) >::type * >
+{
+    return detail::not_null_accessor< typename std::remove_pointer< decltype( p.operator->().get() ) >::type * >::make_unchecked( p.operator->().get() );
+}
+template< class T >
+gsl_NODISCARD gsl_api gsl_constexpr14 not_null< T * >
+borrow( not_null<T *> const & p )
+{
+    return p;
+}
+
 template< class S >
 gsl_NODISCARD gsl_api gsl_constexpr14 auto
 c_str( S const & str ) -> decltype( gsl_lite::make_not_null( str.c_str() ) )
@@ -4433,25 +5549,285 @@ public:
     {}
 };
 
-// more not_null unwanted operators
+#if gsl_HAVE( EXPRESSION_SFINAE )
 
-template< class T, class U >
-std::ptrdiff_t operator-( not_null<T> const &, not_null<U> const & ) gsl_is_delete;
+// scoped_borrow<> - Raw pointer borrowed from a not_null<> smart pointer for the duration of a scope.
+//
+// A `scoped_borrow<>` holds a reference to the owner along with the borrowed pointer. If debug-level contract checks are enabled,
+// every access verifies that the owner still holds the borrowed object, which detects that the owner was reset, reassigned, or
+// moved from. The owner itself must outlive the `scoped_borrow<>`: its destruction cannot be detected, so borrowing from a
+// temporary is not permitted.
 
-template< class T >
-not_null<T> operator-( not_null<T> const &, std::ptrdiff_t ) gsl_is_delete;
+template< class P >
+class scoped_borrow
+{
+public:
+    typedef typename std::remove_pointer< decltype( std::declval< P const & >().get() ) >::type element_type;
 
-template< class T >
-not_null<T> operator+( not_null<T> const &, std::ptrdiff_t ) gsl_is_delete;
+private:
+    not_null<P> const & owner_;
+    not_null< element_type * > ptr_;
 
-template< class T >
-not_null<T> operator+( std::ptrdiff_t, not_null<T> const & ) gsl_is_delete;
+    gsl_api gsl_constexpr14 void
+    check() const
+    {
+        gsl_AssertDebug( is_valid( owner_ ) && owner_.operator->().get() == as_nullable( ptr_ ) );
+    }
 
-// not_null comparisons
+public:
+    gsl_api gsl_constexpr14 explicit scoped_borrow( not_null<P> const & owner )
+    : owner_( owner ), ptr_( borrow( owner ) )
+    {
+    }
 
-#if gsl_HAVE( NULLPTR ) && gsl_HAVE( IS_DELETE )
-template< class T >
-gsl_constexpr bool
+    gsl_NODISCARD gsl_api gsl_constexpr14 not_null< element_type * >
+    get() const
+    {
+        check();
+        return ptr_;
+    }
+    gsl_NODISCARD gsl_api gsl_constexpr14
+    operator not_null< element_type * >() const
+    {
+        return get();
+    }
+    gsl_NODISCARD gsl_api gsl_constexpr14 element_type *
+    operator->() const
+    {
+        check();
+        return as_nullable( ptr_ );
+    }
+    gsl_NODISCARD gsl_api gsl_constexpr14 element_type &
+    operator*() const
+    {
+        check();
+        return *ptr_;
+    }
+
+gsl_is_delete_access:
+    scoped_borrow( not_null<P> const && ) gsl_is_delete;
+    scoped_borrow( scoped_borrow const & ) gsl_is_delete;
+    scoped_borrow & operator=( scoped_borrow const & ) gsl_is_delete;
+};
+# if gsl_HAVE( DEDUCTION_GUIDES )
+template< class P >
+scoped_borrow( not_null<P> const & ) -> scoped_borrow<P>;
+# endif // gsl_HAVE( DEDUCTION_GUIDES )
+
+#endif // gsl_HAVE( EXPRESSION_SFINAE )
+
+#if gsl_HAVE( VARIADIC_TEMPLATE ) && gsl_HAVE( EXPRESSION_SFINAE ) && gsl_HAVE( TYPE_TRAITS )
+
+// not_null_function_ref<> - Non-owning reference to a callable which is never null.
+
+# if gsl_CPP17_OR_GREATER
+// Tag for binding a member function or function pointer at compile time, cf. `std::nontype_t<>` in C++26.
+template< auto F >
+struct nontype_t
+{
+    explicit nontype_t() = default;
+};
+template< auto F >
+inline constexpr nontype_t< F > nontype{};
+# endif // gsl_CPP17_OR_GREATER
+
+namespace detail {
+
+// Minimal INVOKE: callables and pointers to member functions called on an object or through a pointer.
+template< class F, class... Args >
+gsl_api gsl_constexpr auto
+invoke_( F && f, Args &&... args )
+    -> decltype( std::forward<F>( f )( std::forward<Args>( args )... ) )
+{
+    return std::forward<F>( f )( std::forward<Args>( args )... );
+}
+template< class M, class C, class Obj, class... Args >
+gsl_api gsl_constexpr auto
+invoke_( M C::* pm, Obj && obj, Args &&... args )
+    -> decltype( ( std::forward<Obj>( obj ).*pm )( std::forward<Args>( args )... ) )
+{
+    return ( std::forward<Obj>( obj ).*pm )( std::forward<Args>( args )... );
+}
+template< class M, class C, class Obj, class... Args >
+gsl_api gsl_constexpr auto
+invoke_( M C::* pm, Obj && obj, Args &&... args )
+    -> decltype( ( ( *std::forward<Obj>( obj ) ).*pm )( std::forward<Args>( args )... ) )
+{
+    return ( ( *std::forward<Obj>( obj ) ).*pm )( std::forward<Args>( args )... );
+}
+
+template< class R, class F, class... Args >
+struct is_invocable_r_
+{
+private:
+    template< class G >
+    static auto test( int ) -> std11::integral_constant< bool,
+        std::is_void<R>::value || std::is_convertible< decltype( invoke_( std::declval<G>(), std::declval<Args>()... ) ), R >::value >;
+    template< class G >
+    static std11::false_type test( ... );
+
+public:
+    static const bool value = decltype( test< F >( 0 ) )::value;
+};
+
+template< class R >
+struct invoke_r_
+{
+    template< class F, class... Args >
+    static gsl_api R
+    call( F && f, Args &&... args )
+    {
+        return invoke_( std::forward<F>( f ), std::forward<Args>( args )... );
+    }
+};
+template<>
+struct invoke_r_< void >
+{
+    template< class F, class... Args >
+    static gsl_api void
+    call( F && f, Args &&... args )
+    {
+        invoke_( std::forward<F>( f ), std::forward<Args>( args )... );
+    }
+};
+
+union function_ref_storage_
+{
+    void const * obj;
+    void ( *fn )();
+};
+
+} // namespace detail
+
+// A `not_null_function_ref<R(Args...)>` is two pointers wide and never allocates. It refers to a function or to a callable
+// object, which must outlive the reference. Nullness is checked once on construction, so the call operator is unconditional.
+// Like `std::function_ref<>`, it cannot be constructed from a pointer to member function, which would have to be referred to
+// by address; in C++17 and higher, member functions are bound with `nontype<>` instead.
+
+template< class R, class... Args >
+class not_null_function_ref< R( Args... ) >
+{
+private:
+    typedef R ( *thunk_type )( detail::function_ref_storage_, Args... );
+
+    detail::function_ref_storage_ storage_;
+    thunk_type thunk_;
+
+    template< class T >
+    static gsl_api R
+    call_object( detail::function_ref_storage_ s, Args... args )
+    {
+        return detail::invoke_r_< R >::call( *static_cast< T * >( const_cast< void * >( s.obj ) ), std::forward<Args>( args )... );
+    }
+    template< class Fp >
+    static gsl_api R
+    call_function( detail::function_ref_storage_ s, Args... args )
+    {
+        return detail::invoke_r_< R >::call( reinterpret_cast< Fp >( s.fn ), std::forward<Args>( args )... );
+    }
+# if gsl_CPP17_OR_GREATER
+    template< auto F >
+    static gsl_api R
+    call_constant( detail::function_ref_storage_, Args... args )
+    {
+        return detail::invoke_r_< R >::call( F, std::forward<Args>( args )... );
+    }
+    template< auto F, class T >
+    static gsl_api R
+    call_bound( detail::function_ref_storage_ s, Args... args )
+    {
+        return detail::invoke_r_< R >::call( F, *static_cast< T * >( const_cast< void * >( s.obj ) ), std::forward<Args>( args )... );
+    }
+# endif // gsl_CPP17_OR_GREATER
+
+public:
+    // Function pointers and functions.
+    template< class F
+        gsl_ENABLE_IF_(( std::is_function<F>::value && detail::is_invocable_r_< R, F *, Args... >::value ))
+    >
+    gsl_api gsl_constexpr14 not_null_function_ref( F * f )
+    : thunk_( &call_function< F * > )
+    {
+        gsl_Expects( f != gsl_nullptr );
+        storage_.fn = reinterpret_cast< void ( * )() >( f );
+    }
+    template< class F
+        gsl_ENABLE_IF_(( std::is_function<F>::value && detail::is_invocable_r_< R, F *, Args... >::value ))
+    >
+    gsl_api gsl_constexpr14 not_null_function_ref( not_null< F * > f ) gsl_noexcept
+    : thunk_( &call_function< F * > )
+    {
+        storage_.fn = reinterpret_cast< void ( * )() >( as_nullable( f ) );
+    }
+
+    // Callable objects, e.g. lambdas.
+    template< class F
+        gsl_ENABLE_IF_((
+            ! std::is_same< typename std::decay<F>::type, not_null_function_ref >::value
+            && ! std::is_pointer< typename std::decay<F>::type >::value
+            && ! std::is_member_pointer< typename std::decay<F>::type >::value
+            && ! detail::is_not_null_or_bool_oracle< typename std::decay<F>::type >::value
+            && detail::is_invocable_r_< R, typename std::remove_reference<F>::type &, Args... >::value ))
+    >
+    gsl_api gsl_constexpr14 not_null_function_ref( F && f ) gsl_noexcept
+    : thunk_( &call_object< typename std::remove_reference<F>::type > )
+    {
+        storage_.obj = gsl_ADDRESSOF( f );
+    }
+
+# if gsl_CPP17_OR_GREATER
+    // Member function or function bound at compile time. A member function is called with the object or a pointer to it as first
+    // argument.
+    template< auto F
+        gsl_ENABLE_IF_(( detail::is_invocable_r_< R, decltype( F ), Args... >::value ))
+    >
+    gsl_api constexpr not_null_function_ref( nontype_t< F > ) gsl_noexcept
+    : thunk_( &call_constant< F > )
+    {
+        static_assert( F != nullptr, "nontype<F> requires a non-null function or member function pointer" );
+        storage_.obj = gsl_nullptr;
+    }
+
+    // Member function or function bound at compile time to an object `obj`, which is passed as first argument.
+    template< auto F, class T
+        gsl_ENABLE_IF_(( detail::is_invocable_r_< R, decltype( F ), T &, Args... >::value ))
+    >
+    gsl_api constexpr not_null_function_ref( nontype_t< F >, T & obj ) gsl_noexcept
+    : thunk_( &call_bound< F, T > )
+    {
+        static_assert( F != nullptr, "nontype<F> requires a non-null function or member function pointer" );
+        storage_.obj = gsl_ADDRESSOF( obj );
+    }
+# endif // gsl_CPP17_OR_GREATER
+
+    gsl_api R
+    operator()( Args... args ) const
+    {
+        return thunk_( storage_, std::forward<Args>( args )... );
+    }
+};
+
+#endif // gsl_HAVE( VARIADIC_TEMPLATE ) && gsl_HAVE( EXPRESSION_SFINAE ) && gsl_HAVE( TYPE_TRAITS )
+
+// more not_null unwanted operators
+
+template< class T, class U >
+std::ptrdiff_t operator-( not_null<T> const &, not_null<U> const & ) gsl_is_delete;
+
+template< class T >
+not_null<T> operator-( not_null<T> const &, std::ptrdiff_t ) gsl_is_delete;
+
+template< class T >
+not_null<T> operator+( not_null<T> const &, std::ptrdiff_t ) gsl_is_delete;
+
+template< class T >
+not_null<T> operator+( std::ptrdiff_t, not_null<T> const & ) gsl_is_delete;
+
+// not_null comparisons
+
+#if gsl_HAVE( NULLPTR ) && gsl_HAVE( IS_DELETE )
+template< class T >
+gsl_constexpr bool
 operator==( not_null<T> const &, std::nullptr_t ) = delete;
 template< class T >
 gsl_constexpr bool
@@ -4624,1496 +6000,6062 @@ gsl_RETURN_DECLTYPE_( !( l < r ) )
     return !( l < r );
 }
 
-// print not_null
-
-template< class CharType, class Traits, class T >
-gsl_TRAILING_RETURN_TYPE_2_( std::basic_ostream< CharType, Traits > & )
-operator<<( std::basic_ostream< CharType, Traits > & os, not_null<T> const & p )
-gsl_RETURN_DECLTYPE_( os << p.operator->() )
-{
-    return os << p.operator->();
-}
-
-
-#if gsl_HAVE( VARIADIC_TEMPLATE )
-# if gsl_HAVE( UNIQUE_PTR )
-template< class T, class... Args >
-gsl_NODISCARD not_null<std::unique_ptr<T>>
-make_unique( Args &&... args )
-{
-#  if gsl_HAVE( TYPE_TRAITS )
-    static_assert( !std::is_array<T>::value, "gsl_lite::make_unique<T>() returns `gsl_lite::not_null<std::unique_ptr<T>>`, which is not "
-        "defined for array types because the Core Guidelines advise against pointer arithmetic, cf. \"Bounds safety profile\"." );
-#  endif
-    return not_null<std::unique_ptr<T>>( new T( std::forward<Args>( args )... ) );
-}
-# endif // gsl_HAVE( UNIQUE_PTR )
-# if gsl_HAVE( SHARED_PTR )
-template< class T, class... Args >
-gsl_NODISCARD not_null<std::shared_ptr<T>>
-make_shared( Args &&... args )
-{
-#  if gsl_HAVE( TYPE_TRAITS )
-    static_assert( !std::is_array<T>::value, "gsl_lite::make_shared<T>() returns `gsl_lite::not_null<std::shared_ptr<T>>`, which is not "
-        "defined for array types because the Core Guidelines advise against pointer arithmetic, cf. \"Bounds safety profile\"." );
-#  endif
-    return not_null<std::shared_ptr<T>>( std::make_shared<T>( std::forward<Args>( args )... ) );
-}
-# endif // gsl_HAVE( SHARED_PTR )
-#endif // gsl_HAVE( VARIADIC_TEMPLATE )
-
-
-#if gsl_FEATURE( BYTE )
-//
-// Byte-specific type.
+// optional_not_null<> - Nullable counterpart of not_null<> which uses the null value as its disengaged state.
 //
-# if gsl_HAVE( ENUM_CLASS_CONSTRUCTION_FROM_UNDERLYING_TYPE )
-  enum class gsl_may_alias byte : unsigned char {};
-# else
-#  if ! defined( gsl_CONFIG_ACKNOWLEDGE_NONSTANDARD_ABI )
-#   pragma message (__FILE__ "(" gsl_STRINGIFY( __LINE__ ) "): warning: in pre-C++11 mode, byte is defined as a struct rather than an enum, which changes the ABI of gsl-lite and may lead to ODR violations and undefined behavior; define the macro gsl_CONFIG_ACKNOWLEDGE_NONSTANDARD_ABI to explicitly acknowledge that you are using gsl-lite with a non-standard ABI and that you control the build flags of all components linked into your target")
-#  endif
-  struct gsl_may_alias byte { typedef unsigned char type; type v; };
-# endif
+// Unlike `std::optional< not_null<T> >`, which needs an additional engagement flag, `optional_not_null<T>` has the size
+// and layout of `T`, and it is trivially copyable if `T` is (e.g. for raw pointers).
+
+namespace detail {
 
 template< class T >
-gsl_NODISCARD gsl_api inline gsl_constexpr byte
-to_byte( T v ) gsl_noexcept
-{
-# if    gsl_HAVE( ENUM_CLASS_CONSTRUCTION_FROM_UNDERLYING_TYPE )
-    return static_cast<byte>( v );
-# elif  gsl_HAVE( CONSTEXPR_11 )
-    return { static_cast<typename byte::type>( v ) };
-# else
-    byte b = { static_cast<typename byte::type>( v ) }; return b;
-# endif
-}
+struct optional_not_null_accessor;
 
-template< class IntegerType  gsl_ENABLE_IF_(( std::is_integral<IntegerType>::value )) >
-gsl_NODISCARD gsl_api inline gsl_constexpr IntegerType
-to_integer( byte b ) gsl_noexcept
+template< class T, class Derived, bool IsDereferencable = is_dereferencable< T >::value >
+struct optional_not_null_base
 {
-# if gsl_HAVE( ENUM_CLASS_CONSTRUCTION_FROM_UNDERLYING_TYPE )
-    return static_cast<typename std::underlying_type<byte>::type>( b );
-# else
-    return b.v;
-# endif
-}
-
-gsl_NODISCARD gsl_api inline gsl_constexpr unsigned char
-to_uchar( byte b ) gsl_noexcept
+    gsl_NODISCARD gsl_api gsl_constexpr14 typename element_type_helper<T>::type &
+    operator*() const
+    {
+        return *static_cast< Derived const & >( *this ).operator->();
+    }
+};
+template< class T, class Derived >
+struct optional_not_null_base< T, Derived, false >  // e.g. `void*`, `std::function<>`
 {
-    return to_integer<unsigned char>( b );
-}
+};
 
-gsl_NODISCARD gsl_api inline gsl_constexpr unsigned char
-to_uchar( int i ) gsl_noexcept
-{
-    return static_cast<unsigned char>( i );
-}
+} // namespace detail
 
-template< class IntegerType  gsl_ENABLE_IF_(( std::is_integral<IntegerType>::value )) >
-gsl_api inline gsl_constexpr14 byte &
-operator<<=( byte & b, IntegerType shift ) gsl_noexcept
+template< gsl_CONSTRAINT( nullable ) T >
+class
+gsl_EMPTY_BASES_
+optional_not_null : public detail::optional_not_null_base< T, optional_not_null<T> >
 {
-# if gsl_HAVE( ENUM_CLASS_CONSTRUCTION_FROM_UNDERLYING_TYPE )
-    return b = ::gsl_lite::to_byte( ::gsl_lite::to_uchar( b ) << shift );
-# else
-    b.v = ::gsl_lite::to_uchar( b.v << shift ); return b;
-# endif
-}
+private:
+    T ptr_;
 
-template< class IntegerType  gsl_ENABLE_IF_(( std::is_integral<IntegerType>::value )) >
-gsl_NODISCARD gsl_api inline gsl_constexpr byte
-operator<<( byte b, IntegerType shift ) gsl_noexcept
-{
-    return ::gsl_lite::to_byte( ::gsl_lite::to_uchar( b ) << shift );
-}
+    template< class U >
+    friend struct detail::optional_not_null_accessor;
 
-template< class IntegerType  gsl_ENABLE_IF_(( std::is_integral<IntegerType>::value )) >
-gsl_NODISCARD gsl_api inline gsl_constexpr14 byte &
-operator>>=( byte & b, IntegerType shift ) gsl_noexcept
-{
-# if gsl_HAVE( ENUM_CLASS_CONSTRUCTION_FROM_UNDERLYING_TYPE )
-    return b = ::gsl_lite::to_byte( ::gsl_lite::to_uchar( b ) >> shift );
-# else
-    b.v = ::gsl_lite::to_uchar( b.v >> shift ); return b;
+#if gsl_HAVE( TYPE_TRAITS )
+    static_assert( ! std::is_reference<T>::value, "T may not be a reference type" );
+    static_assert( ! std::is_const<T>::value && ! std::is_volatile<T>::value, "T may not be cv-qualified" );
+# ifndef __cpp_lib_concepts
+    static_assert( is_nullable<T>::value, "T must be a nullable type" );
 # endif
-}
-
-template< class IntegerType  gsl_ENABLE_IF_(( std::is_integral<IntegerType>::value )) >
-gsl_NODISCARD gsl_api inline gsl_constexpr byte
-operator>>( byte b, IntegerType shift ) gsl_noexcept
-{
-    return ::gsl_lite::to_byte( ::gsl_lite::to_uchar( b ) >> shift );
-}
+#endif
 
-# if gsl_HAVE( ENUM_CLASS_CONSTRUCTION_FROM_UNDERLYING_TYPE )
-gsl_DEFINE_ENUM_BITMASK_OPERATORS( byte )
-gsl_DEFINE_ENUM_RELATIONAL_OPERATORS( byte )
-# else // a.k.a. !gsl_HAVE( ENUM_CLASS_CONSTRUCTION_FROM_UNDERLYING_TYPE )
-gsl_api inline gsl_constexpr bool operator==( byte l, byte r ) gsl_noexcept
-{
-    return l.v == r.v;
-}
+public:
+    gsl_api gsl_constexpr optional_not_null() gsl_noexcept
+    : ptr_()
+    {
+    }
+#if gsl_HAVE( NULLPTR )
+    gsl_api gsl_constexpr optional_not_null( std::nullptr_t ) gsl_noexcept
+    : ptr_()
+    {
+    }
+#endif // gsl_HAVE( NULLPTR )
 
-gsl_api inline gsl_constexpr bool operator!=( byte l, byte r ) gsl_noexcept
-{
-    return !( l == r );
-}
+    // Construction from a nullable value has no precondition: a null value yields a disengaged object.
+#if gsl_HAVE( MOVE_FORWARD )
+    gsl_api gsl_constexpr14 optional_not_null( T other )
+    : ptr_( std::move( other ) )
+    {
+    }
+    template< class U
+        gsl_ENABLE_IF_(( std::is_constructible<T, U>::value ))
+    >
+    gsl_api gsl_constexpr14 optional_not_null( not_null<U> other )
+    : ptr_( detail::no_adl::as_nullable( std::move( other ) ) )
+    {
+    }
+#else // a.k.a. ! gsl_HAVE( MOVE_FORWARD )
+    gsl_api optional_not_null( T const & other )
+    : ptr_( other )
+    {
+    }
+    template< class U >
+    gsl_api optional_not_null( not_null<U> const & other )
+    : ptr_( detail::no_adl::as_nullable( other ) )
+    {
+    }
+#endif // gsl_HAVE( MOVE_FORWARD )
 
-gsl_api inline gsl_constexpr bool operator< ( byte l, byte r ) gsl_noexcept
-{
-    return l.v < r.v;
-}
+    gsl_NODISCARD gsl_api gsl_constexpr bool
+    has_value() const gsl_noexcept
+    {
+        return ptr_ != gsl_nullptr;
+    }
+#if gsl_HAVE( EXPLICIT )
+    gsl_NODISCARD gsl_api gsl_constexpr explicit
+    operator bool() const gsl_noexcept
+    {
+        return has_value();
+    }
+#endif // gsl_HAVE( EXPLICIT )
 
-gsl_api inline gsl_constexpr bool operator<=( byte l, byte r ) gsl_noexcept
-{
-    return !( r < l );
-}
+    gsl_NODISCARD gsl_api gsl_constexpr14 not_null<T>
+    value() const
+#if gsl_HAVE( FUNCTION_REF_QUALIFIER )
+    &
+#endif
+    {
+        gsl_Expects( has_value() );
+        return not_null<T>( ptr_ );
+    }
+#if gsl_HAVE( FUNCTION_REF_QUALIFIER ) && gsl_HAVE( MOVE_FORWARD )
+    gsl_NODISCARD gsl_api gsl_constexpr14 not_null<T>
+    value() &&
+    {
+        gsl_Expects( has_value() );
+        return not_null<T>( std::move( ptr_ ) );
+    }
+#endif // gsl_HAVE( FUNCTION_REF_QUALIFIER ) && gsl_HAVE( MOVE_FORWARD )
 
-gsl_api inline gsl_constexpr bool operator> ( byte l, byte r ) gsl_noexcept
+    gsl_NODISCARD gsl_api gsl_constexpr14 T const &
+    operator->() const
+    {
+        gsl_Expects( has_value() );
+        return ptr_;
+    }
+
+    gsl_api gsl_constexpr14 void
+    reset() gsl_noexcept
+    {
+        ptr_ = T();
+    }
+};
+
+namespace detail {
+
+template< class T >
+struct optional_not_null_accessor
 {
-    return ( r < l );
-}
+    static gsl_api gsl_constexpr T const & get( optional_not_null<T> const & p ) gsl_noexcept
+    {
+        return p.ptr_;
+    }
+#if gsl_HAVE( MOVE_FORWARD )
+    static gsl_api gsl_constexpr14 T get( optional_not_null<T> && p ) gsl_noexcept
+    {
+        return std::move( p.ptr_ );
+    }
+#endif // gsl_HAVE( MOVE_FORWARD )
+};
 
-gsl_api inline gsl_constexpr bool operator>=( byte l, byte r ) gsl_noexcept
+namespace no_adl {
+
+template< class T >
+gsl_NODISCARD gsl_api gsl_constexpr T const &
+as_nullable( optional_not_null<T> const & p ) gsl_noexcept
 {
-    return !( l < r );
+    return detail::optional_not_null_accessor<T>::get( p );
 }
-
-gsl_api inline gsl_constexpr14 byte & operator|=( byte & l, byte r ) gsl_noexcept
+#if gsl_HAVE( MOVE_FORWARD )
+template< class T >
+gsl_NODISCARD gsl_api gsl_constexpr14 T
+as_nullable( optional_not_null<T> && p ) gsl_noexcept
 {
-    l.v |= r.v; return l;
+    return detail::optional_not_null_accessor<T>::get( std::move( p ) );
 }
+#endif // gsl_HAVE( MOVE_FORWARD )
 
-gsl_api inline gsl_constexpr byte operator|( byte l, byte r ) gsl_noexcept
+} // namespace no_adl
+} // namespace detail
+
+// optional_not_null comparisons
+
+template< class T, class U >
+gsl_NODISCARD inline gsl_api gsl_constexpr gsl_TRAILING_RETURN_TYPE_( bool )
+operator==( optional_not_null<T> const & l, optional_not_null<U> const & r )
+gsl_RETURN_DECLTYPE_( as_nullable( l ) == as_nullable( r ) )
 {
-    return ::gsl_lite::to_byte( l.v | r.v );
+    return as_nullable( l ) == as_nullable( r );
 }
-
-gsl_api inline gsl_constexpr14 byte & operator&=( byte & l, byte r ) gsl_noexcept
+#if gsl_HAVE( NULLPTR )
+template< class T >
+gsl_NODISCARD inline gsl_api gsl_constexpr bool
+operator==( optional_not_null<T> const & l, std::nullptr_t ) gsl_noexcept
 {
-    l.v &= r.v; return l;
+    return ! l.has_value();
 }
-
-gsl_api inline gsl_constexpr byte operator&( byte l, byte r ) gsl_noexcept
+#endif // gsl_HAVE( NULLPTR )
+#ifndef __cpp_lib_three_way_comparison
+# if gsl_HAVE( NULLPTR )
+template< class T >
+gsl_NODISCARD inline gsl_api gsl_constexpr bool
+operator==( std::nullptr_t, optional_not_null<T> const & r ) gsl_noexcept
 {
-    return ::gsl_lite::to_byte( l.v & r.v );
+    return ! r.has_value();
 }
-
-gsl_api inline gsl_constexpr14 byte & operator^=( byte & l, byte r ) gsl_noexcept
+template< class T >
+gsl_NODISCARD inline gsl_api gsl_constexpr bool
+operator!=( optional_not_null<T> const & l, std::nullptr_t ) gsl_noexcept
 {
-    l.v ^= r.v; return l;
+    return l.has_value();
 }
-
-gsl_api inline gsl_constexpr byte operator^( byte l, byte r ) gsl_noexcept
+template< class T >
+gsl_NODISCARD inline gsl_api gsl_constexpr bool
+operator!=( std::nullptr_t, optional_not_null<T> const & r ) gsl_noexcept
 {
-    return ::gsl_lite::to_byte( l.v ^ r.v );
+    return r.has_value();
 }
-
-gsl_api inline gsl_constexpr byte operator~( byte b ) gsl_noexcept
+# endif // gsl_HAVE( NULLPTR )
+template< class T, class U >
+gsl_NODISCARD inline gsl_api gsl_constexpr gsl_TRAILING_RETURN_TYPE_( bool )
+operator!=( optional_not_null<T> const & l, optional_not_null<U> const & r )
+gsl_RETURN_DECLTYPE_( !( l == r ) )
 {
-    return ::gsl_lite::to_byte( ~b.v );
+    return !( l == r );
 }
-# endif // gsl_HAVE( ENUM_CLASS_CONSTRUCTION_FROM_UNDERLYING_TYPE )
-#endif // gsl_FEATURE( BYTE )
-
-#if gsl_FEATURE_TO_STD( WITH_CONTAINER )
-
-// Tag to select span constructor taking a container:
-
-struct with_container_t { gsl_constexpr with_container_t( ) gsl_noexcept { } };
-const  gsl_constexpr   with_container_t with_container; // TODO: this can lead to ODR violations because the symbol will be defined in multiple translation units
-
 #endif
 
+// not_null_tagged<> - not_null<> for raw pointers which stores a small tag in the low-order bits of the pointer.
+//
+// The number of tag bits must not exceed log2( alignof( T ) ). The alignment requirement is checked when a
+// `not_null_tagged<>` is constructed rather than when the class is instantiated, so `T` may be incomplete at the point of
+// declaration, as is typical for intrusive data structures.
 
-#if gsl_FEATURE( SPAN )
-// The span<> and span_iterator<> implementation below was mostly borrowed from Microsoft GSL.
-
-
-# if gsl_COMPILER_MSVC_VER
-#  pragma warning( push )
-
-// turn off some warnings that are noisy about our Expects statements
-#  pragma warning( disable : 4127 ) // conditional expression is constant
-#  pragma warning( disable : 4146 ) // unary minus operator applied to unsigned type, result still unsigned
-#  pragma warning( disable : 4702 ) // unreachable code
-
-// Turn off MSVC /analyze rules that generate too much noise
-#  pragma warning( disable : 26495 ) // uninitialized member when constructor calls constructor
-#  pragma warning( disable : 26446 ) // parser bug does not allow attributes on some templates
-
-# endif // gsl_COMPILER_MSVC_VER
-
-// GCC 7 does not like the signed unsigned mismatch (size_t ptrdiff_t)
-// While there is a conversion from signed to unsigned, it happens at
-// compiletime, so the compiler wouldn't have to warn indiscriminately, but
-// could check if the source value actually doesn't fit into the target type
-// and only warn in those cases.
-# if defined( __GNUC__ ) && __GNUC__ > 6
-#  pragma GCC diagnostic push
-#  pragma GCC diagnostic ignored "-Wsign-conversion"
-# endif // defined( __GNUC__ ) && __GNUC__ > 6
+#if gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( SIZED_TYPES )
 
-// Turn off clang unsafe buffer warnings as all accessed are guarded by runtime checks
-# if defined( __clang__ )
-#  if __has_warning( "-Wunsafe-buffer-usage" )
-#   pragma clang diagnostic push
-#   pragma clang diagnostic ignored "-Wunsafe-buffer-usage"
-#  endif // __has_warning( "-Wunsafe-buffer-usage" )
-# endif // defined( __clang__ )
+template< class P, std::size_t Bits >
+class not_null_tagged;
 
-namespace detail {
+# if gsl_FEATURE( EXPERIMENTAL_ATOMIC_NOT_NULL )
+template< class P, std::size_t Bits >
+class atomic_not_null_tagged;
+# endif // gsl_FEATURE( EXPERIMENTAL_ATOMIC_NOT_NULL )
 
-template< gsl_CONFIG_SPAN_INDEX_TYPE From, gsl_CONFIG_SPAN_INDEX_TYPE To >
-struct is_allowed_extent_conversion
-    : std17::bool_constant< From == To || To == dynamic_extent >
+template< class T, std::size_t Bits >
+class not_null_tagged< T *, Bits >
 {
-};
+private:
+    std::uintptr_t bits_;
 
-# if gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( DEFAULT_FUNCTION_TEMPLATE_ARG )
-template< class From, class To >
-struct is_allowed_element_type_conversion
-    : std17::bool_constant< std::is_convertible< From (*)[], To (*)[] >::value >
-{
-};
-# endif // gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( DEFAULT_FUNCTION_TEMPLATE_ARG )
+# if gsl_FEATURE( EXPERIMENTAL_ATOMIC_NOT_NULL )
+    template< class P, std::size_t B >
+    friend class atomic_not_null_tagged;
+# endif // gsl_FEATURE( EXPERIMENTAL_ATOMIC_NOT_NULL )
 
-template< class T >
-class span_iterator
-{
-public:
-# if gsl_STDLIB_CPP20_OR_GREATER
-    typedef typename std::contiguous_iterator_tag iterator_concept;
-# endif // gsl_STDLIB_CPP20_OR_GREATER
-    typedef typename std::random_access_iterator_tag iterator_category;
-    typedef typename std11::remove_cv< T >::type value_type;
-    typedef std::ptrdiff_t difference_type;
-    typedef T * pointer;
-    typedef T & reference;
+    struct from_bits_tag { };
 
-# ifdef gsl_COMPILER_MS_STL_VERSION
-    typedef pointer _Unchecked_type;
-    typedef span_iterator _Prevent_inheriting_unwrap;
-# endif // gsl_COMPILER_MS_STL_VERSION
-# if gsl_HAVE( IS_DEFAULT )
-    gsl_constexpr span_iterator() = default;
-# else // ! gsl_HAVE( IS_DEFAULT )
-    gsl_api gsl_constexpr span_iterator() gsl_noexcept
-        : begin_( gsl_nullptr ), end_( gsl_nullptr ), current_( gsl_nullptr )
+    gsl_api gsl_constexpr not_null_tagged( std::uintptr_t bits, from_bits_tag ) gsl_noexcept
+    : bits_( bits )
     {
     }
-# endif // gsl_HAVE( IS_DEFAULT )
 
-    gsl_api gsl_constexpr14 span_iterator( pointer begin, pointer end, pointer current )
-        : begin_( begin ), end_( end ), current_( current )
+    gsl_NODISCARD static gsl_api gsl_constexpr std::uintptr_t
+    tag_mask() gsl_noexcept
     {
-        gsl_ExpectsDebug( begin_ <= current_ && current <= end_ );
+        return ( std::uintptr_t( 1 ) << Bits ) - 1;
     }
-
-    gsl_api gsl_constexpr14 operator span_iterator< T const >() const gsl_noexcept
+    gsl_NODISCARD static gsl_api std::uintptr_t
+    pack( T * ptr, std::uintptr_t tag )
     {
-        return span_iterator< T const >( begin_, end_, current_ );
+        static_assert( ( std::size_t( 1 ) << Bits ) <= std::alignment_of< T >::value, "not enough alignment bits for the requested number of tag bits" );
+
+        std::uintptr_t const addr = reinterpret_cast< std::uintptr_t >( ptr );
+        gsl_Expects( ptr != gsl_nullptr );
+        gsl_Expects( ( addr & tag_mask() ) == 0 );
+        gsl_Expects( tag <= tag_mask() );
+        return addr | tag;
     }
 
-    gsl_api gsl_constexpr14 reference operator*() const
+public:
+    typedef T element_type;
+    typedef std::uintptr_t tag_type;
+
+    gsl_api explicit not_null_tagged( T * ptr, tag_type tag = 0 )
+    : bits_( pack( ptr, tag ) )
+    {
+    }
+    gsl_api not_null_tagged( not_null< T * > ptr, tag_type tag = 0 )
+    : bits_( pack( as_nullable( ptr ), tag ) )
     {
-        gsl_ExpectsDebug( current_ != end_ );
-        return *current_;
     }
 
-    gsl_api gsl_constexpr14 pointer operator->() const
+    gsl_NODISCARD gsl_api T *
+    operator->() const gsl_noexcept
     {
-        gsl_ExpectsDebug( current_ != end_ );
-        return current_;
+        return reinterpret_cast< T * >( bits_ & ~tag_mask() );
     }
-    gsl_api gsl_constexpr14 span_iterator& operator++()
+    gsl_NODISCARD gsl_api T &
+    operator*() const gsl_noexcept
     {
-        gsl_ExpectsDebug( current_ != end_ );
-        gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
-        ++current_;
-        return *this;
+        return *operator->();
     }
 
-    gsl_api gsl_constexpr14 span_iterator operator++( int )
+    gsl_NODISCARD gsl_api not_null< T * >
+    pointer() const
     {
-        span_iterator ret = *this;
-        ++*this;
-        return ret;
+        return detail::not_null_accessor< T * >::make_unchecked( operator->() );
     }
-
-    gsl_api gsl_constexpr14 span_iterator& operator--()
+    gsl_NODISCARD gsl_api gsl_constexpr tag_type
+    tag() const gsl_noexcept
     {
-        gsl_ExpectsDebug( begin_ != current_ );
-        --current_;
-        return *this;
+        return bits_ & tag_mask();
     }
 
-    gsl_api gsl_constexpr14 span_iterator operator--( int )
+    gsl_api void
+    set_pointer( not_null< T * > ptr )
     {
-        span_iterator ret = *this;
-        --*this;
-        return ret;
+        bits_ = pack( as_nullable( ptr ), tag() );
     }
-
-    gsl_api gsl_constexpr14 span_iterator& operator+=( difference_type const n )
+    gsl_api gsl_constexpr14 void
+    set_tag( tag_type tag )
     {
-        if ( n != 0 ) gsl_ExpectsDebug( begin_ && current_ && end_ );
-        if ( n > 0 )  gsl_ExpectsDebug( end_ - current_ >= n );
-        if ( n < 0 )  gsl_ExpectsDebug( current_ - begin_ >= -n );
-        gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
-        current_ += n;
-        return *this;
+        gsl_Expects( tag <= tag_mask() );
+        bits_ = ( bits_ & ~tag_mask() ) | tag;
     }
 
-    gsl_api gsl_constexpr14 span_iterator operator+( difference_type const n ) const
+    gsl_NODISCARD friend gsl_api gsl_constexpr bool
+    operator==( not_null_tagged const & lhs, not_null_tagged const & rhs ) gsl_noexcept
     {
-        span_iterator ret = *this;
-        ret += n;
-        return ret;
+        return lhs.bits_ == rhs.bits_;
     }
-
-    friend gsl_api gsl_constexpr14 span_iterator operator+( difference_type const n,
-                                                            span_iterator const & rhs )
+    gsl_NODISCARD friend gsl_api gsl_constexpr bool
+    operator!=( not_null_tagged const & lhs, not_null_tagged const & rhs ) gsl_noexcept
     {
-        return rhs + n;
+        return lhs.bits_ != rhs.bits_;
     }
+};
 
-    gsl_api gsl_constexpr14 span_iterator& operator-=( difference_type const n )
+# if gsl_FEATURE( EXPERIMENTAL_ATOMIC_NOT_NULL )
+
+// atomic_not_null_tagged<> - Atomic variable holding a not_null_tagged<>; pointer and tag are always updated together.
+
+template< class T, std::size_t Bits >
+class atomic_not_null_tagged< T *, Bits >
+{
+private:
+    std::atomic< std::uintptr_t > bits_;
+
+public:
+    typedef not_null_tagged< T *, Bits > value_type;
+
+    gsl_api explicit atomic_not_null_tagged( value_type desired ) gsl_noexcept
+    : bits_( desired.bits_ )
     {
-        if ( n != 0 ) gsl_ExpectsDebug( begin_ && current_ && end_ );
-        if ( n > 0 )  gsl_ExpectsDebug( current_ - begin_ >= n );
-        if ( n < 0 )  gsl_ExpectsDebug( end_ - current_ >= -n );
-        gsl_SUPPRESS_MSGSL_WARNING(bounds .1)
-        current_ -= n;
-        return *this;
     }
 
-    gsl_api gsl_constexpr14 span_iterator operator-( difference_type const n ) const
+    gsl_NODISCARD gsl_api value_type
+    load( std::memory_order order = std::memory_order_seq_cst ) const gsl_noexcept
     {
-        span_iterator ret = *this;
-        ret -= n;
-        return ret;
+        return value_type( bits_.load( order ), typename value_type::from_bits_tag() );
     }
-
-    template<
-        class U
-        gsl_ENABLE_IF_(( std::is_same< typename std::remove_cv< U >::type, value_type >::value ))
-    >
-    gsl_api gsl_constexpr14 difference_type operator-( span_iterator< U > const & rhs ) const
+    gsl_api void
+    store( value_type desired, std::memory_order order = std::memory_order_seq_cst ) gsl_noexcept
     {
-        gsl_ExpectsDebug( begin_ == rhs.begin_ && end_ == rhs.end_ );
-        return current_ - rhs.current_;
+        bits_.store( desired.bits_, order );
     }
-
-    gsl_api gsl_constexpr14 reference operator[]( difference_type const n ) const
+    gsl_api value_type
+    exchange( value_type desired, std::memory_order order = std::memory_order_seq_cst ) gsl_noexcept
     {
-        return *( *this + n );
+        return value_type( bits_.exchange( desired.bits_, order ), typename value_type::from_bits_tag() );
     }
 
-    template<
-        class U
-        gsl_ENABLE_IF_(( std::is_same< typename std::remove_cv< U >::type, value_type >::value ))
-    >
-    gsl_api gsl_constexpr14 bool operator==( span_iterator< U > const & rhs ) const
+    // On failure, `expected` is updated with the current value.
+    gsl_api bool
+    compare_exchange_weak( value_type & expected, value_type desired, std::memory_order order = std::memory_order_seq_cst ) gsl_noexcept
     {
-        gsl_ExpectsDebug( begin_ == rhs.begin_ && end_ == rhs.end_ );
-        return current_ == rhs.current_;
+        return bits_.compare_exchange_weak( expected.bits_, desired.bits_, order );
     }
-
-    template<
-        class U
-        gsl_ENABLE_IF_(( std::is_same< typename std::remove_cv< U >::type, value_type >::value ))
-    >
-    gsl_api gsl_constexpr14 bool operator!=( span_iterator< U > const & rhs ) const
+    gsl_api bool
+    compare_exchange_strong( value_type & expected, value_type desired, std::memory_order order = std::memory_order_seq_cst ) gsl_noexcept
     {
-        return !( *this == rhs );
+        return bits_.compare_exchange_strong( expected.bits_, desired.bits_, order );
     }
 
-    template<
-        class U
-        gsl_ENABLE_IF_(( std::is_same< typename std::remove_cv< U >::type, value_type >::value ))
-    >
-    gsl_api gsl_constexpr14 bool operator<( span_iterator< U > const & rhs ) const
+    gsl_NODISCARD gsl_api bool
+    is_lock_free() const gsl_noexcept
     {
-        gsl_ExpectsDebug( begin_ == rhs.begin_ && end_ == rhs.end_ );
-        return current_ < rhs.current_;
+        return bits_.is_lock_free();
     }
 
-    template<
-        class U
-        gsl_ENABLE_IF_(( std::is_same< typename std::remove_cv< U >::type, value_type >::value ))
-    >
-    gsl_api gsl_constexpr14 bool operator>( span_iterator< U > const & rhs ) const
+gsl_is_delete_access:
+    atomic_not_null_tagged( atomic_not_null_tagged const & ) gsl_is_delete;
+    atomic_not_null_tagged & operator=( atomic_not_null_tagged const & ) gsl_is_delete;
+};
+
+# endif // gsl_FEATURE( EXPERIMENTAL_ATOMIC_NOT_NULL )
+
+#endif // gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( SIZED_TYPES )
+
+#if gsl_FEATURE( EXPERIMENTAL_ATOMIC_NOT_NULL ) && gsl_STDLIB_CPP11_OR_GREATER
+
+// atomic_not_null<> - Atomic variable holding a non-null raw pointer.
+//
+// The non-null invariant is established when a value is stored, so loading the pointer requires no check.
+
+template< class P >
+class atomic_not_null;
+
+template< class T >
+class atomic_not_null< T * >
+{
+private:
+    std::atomic< T * > ptr_;
+
+    gsl_NODISCARD static gsl_api not_null< T * >
+    make( T * ptr ) gsl_noexcept
     {
-        return rhs < *this;
+        return detail::not_null_accessor< T * >::make_unchecked( ptr );
     }
 
-    template<
-        class U
-        gsl_ENABLE_IF_(( std::is_same< typename std::remove_cv< U >::type, value_type >::value ))
-    >
-    gsl_api gsl_constexpr14 bool operator<=( span_iterator< U > const & rhs ) const
+public:
+    typedef not_null< T * > value_type;
+
+    gsl_api explicit atomic_not_null( value_type desired ) gsl_noexcept
+    : ptr_( as_nullable( desired ) )
     {
-        return !( rhs < *this );
     }
 
-    template<
-        class U
-        gsl_ENABLE_IF_(( std::is_same< typename std::remove_cv< U >::type, value_type >::value ))
-    >
-    gsl_api gsl_constexpr14 bool operator>=( span_iterator< U > const & rhs ) const
+    gsl_NODISCARD gsl_api value_type
+    load( std::memory_order order = std::memory_order_seq_cst ) const gsl_noexcept
     {
-        return !( *this < rhs );
+        return make( ptr_.load( order ) );
     }
-
-# ifdef gsl_COMPILER_MS_STL_VERSION
-    // MSVC++ iterator debugging support; allows STL algorithms in 15.8+
-    // to unwrap span_iterator to a pointer type after a range check in STL
-    // algorithm calls.
-    friend gsl_api gsl_constexpr14 void _Verify_range( span_iterator lhs, span_iterator rhs ) gsl_noexcept
+    gsl_NODISCARD gsl_api
+    operator value_type() const gsl_noexcept
     {
-        // test that [lhs, rhs) forms a valid range inside an STL algorithm
-        gsl_Expects( lhs.begin_ == rhs.begin_ // range spans have to match
-                && lhs.end_ == rhs.end_ &&
-                lhs.current_ <= rhs.current_ ); // range must not be transposed
+        return load();
     }
-
-    gsl_api gsl_constexpr14 void _Verify_offset( difference_type const n ) const gsl_noexcept
+    gsl_api void
+    store( value_type desired, std::memory_order order = std::memory_order_seq_cst ) gsl_noexcept
     {
-        // test that *this + n is within the range of this call
-        if ( n != 0 ) gsl_Expects( begin_ && current_ && end_ );
-        if ( n > 0 )  gsl_Expects( end_ - current_ >= n );
-        if ( n < 0 )  gsl_Expects( current_ - begin_ >= -n );
+        ptr_.store( as_nullable( desired ), order );
     }
-
-    gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
-    gsl_api gsl_constexpr14 pointer _Unwrapped() const gsl_noexcept
+    gsl_api value_type
+    exchange( value_type desired, std::memory_order order = std::memory_order_seq_cst ) gsl_noexcept
     {
-        // after seeking *this to a high water mark, or using one of the
-        // _Verify_xxx functions above, unwrap this span_iterator to a raw
-        // pointer
-        return current_;
+        return make( ptr_.exchange( as_nullable( desired ), order ) );
     }
 
-    // Tell the STL that span_iterator should not be unwrapped if it can't
-    // validate in advance, even in release / optimized builds:
-#  if gsl_CPP17_OR_GREATER
-    static constexpr bool _Unwrap_when_unverified = false;
-#  else
-    static gsl_constexpr const bool _Unwrap_when_unverified = false;
-#  endif
-    gsl_SUPPRESS_MSGSL_WARNING(con.3) // TODO: false positive
-    gsl_api gsl_constexpr14 void _Seek_to( pointer const p ) gsl_noexcept
+    // On failure, `expected` is updated with the current value.
+    gsl_api bool
+    compare_exchange_weak( value_type & expected, value_type desired, std::memory_order order = std::memory_order_seq_cst ) gsl_noexcept
     {
-        // adjust the position of *this to previously verified location p
-        // after _Unwrapped
-        current_ = p;
+        T * current = as_nullable( expected );
+        bool const result = ptr_.compare_exchange_weak( current, as_nullable( desired ), order );
+        expected = make( current );
+        return result;
+    }
+    gsl_api bool
+    compare_exchange_strong( value_type & expected, value_type desired, std::memory_order order = std::memory_order_seq_cst ) gsl_noexcept
+    {
+        T * current = as_nullable( expected );
+        bool const result = ptr_.compare_exchange_strong( current, as_nullable( desired ), order );
+        expected = make( current );
+        return result;
     }
-# endif
 
-# if gsl_HAVE( IS_DEFAULT )
-    pointer begin_ = nullptr;
-    pointer end_ = nullptr;
-    pointer current_ = nullptr;
-# else // ! gsl_HAVE( IS_DEFAULT )
-    pointer begin_;
-    pointer end_;
-    pointer current_;
-# endif // gsl_HAVE( IS_DEFAULT )
+    gsl_NODISCARD gsl_api bool
+    is_lock_free() const gsl_noexcept
+    {
+        return ptr_.is_lock_free();
+    }
 
-# if gsl_STDLIB_CPP11_OR_GREATER
-    template< class Ptr >
-    friend struct std::pointer_traits;
-# endif // gsl_STDLIB_CPP11_OR_GREATER
+gsl_is_delete_access:
+    atomic_not_null( atomic_not_null const & ) gsl_is_delete;
+    atomic_not_null & operator=( atomic_not_null const & ) gsl_is_delete;
 };
 
-template< gsl_CONFIG_SPAN_INDEX_TYPE Ext >
-class extent_type
-{
-public:
-    typedef gsl_CONFIG_SPAN_INDEX_TYPE size_type;
+// hazard_pointer_domain<> - Deferred reclamation of objects published through `atomic_not_null<>`.
+//
+// Readers protect the object they are about to access with a `hazard_pointer_domain<>::guard`. Writers replace the
+// published pointer and pass the old one to `retire()`, which defers deletion until no guard protects the object any more.
+// Up to `MaxGuards` guards may be active at the same time. `retire()` and `reclaim()` must not be called concurrently
+// with each other.
 
-# if gsl_HAVE( IS_DEFAULT )
-    gsl_constexpr extent_type() gsl_noexcept = default;
-# else // ! gsl_HAVE( IS_DEFAULT )
-    gsl_constexpr extent_type() gsl_noexcept { }
-# endif // gsl_HAVE( IS_DEFAULT )
+template< class T, std::size_t MaxGuards = 64, class Deleter = std::default_delete< T > >
+class hazard_pointer_domain
+{
+private:
+    std::atomic< T * > hazards_[ MaxGuards ];
+    std::atomic< bool > in_use_[ MaxGuards ];
+    std::vector< T * > retired_;
+    Deleter deleter_;
 
-    gsl_api gsl_constexpr14 gsl_explicit extent_type( extent_type< dynamic_extent > );
+    gsl_NODISCARD bool
+    is_protected( T * ptr ) const gsl_noexcept
+    {
+        for ( std::size_t i = 0; i != MaxGuards; ++i )
+        {
+            if ( hazards_[ i ].load() == ptr )
+            {
+                return true;
+            }
+        }
+        return false;
+    }
 
-    gsl_api gsl_constexpr14 gsl_explicit extent_type( size_type size ) { gsl_Expects( size == Ext ); }
+public:
+    class guard
+    {
+    private:
+        hazard_pointer_domain & domain_;
+        std::size_t index_;
 
-    gsl_api gsl_constexpr size_type size() const gsl_noexcept { return Ext; }
+    public:
+        explicit guard( hazard_pointer_domain & domain )
+        : domain_( domain ), index_( MaxGuards )
+        {
+            for ( std::size_t i = 0; i != MaxGuards; ++i )
+            {
+                if ( ! domain_.in_use_[ i ].exchange( true ) )
+                {
+                    index_ = i;
+                    return;
+                }
+            }
+            gsl_FailFast();  // more than `MaxGuards` guards active at the same time
+        }
+        ~guard()
+        {
+            domain_.hazards_[ index_ ].store( gsl_nullptr );
+            domain_.in_use_[ index_ ].store( false );
+        }
 
-private:
-# if gsl_CPP17_OR_GREATER
-    static constexpr size_type size_ = Ext; // static size equal to Ext
-# else
-    static gsl_constexpr const size_type size_ = Ext; // static size equal to Ext
-# endif
-};
+        // Loads the pointer from `src` and protects the object it points to from being reclaimed until the next call to
+        // `protect()` or until the guard is destroyed.
+        gsl_NODISCARD not_null< T * >
+        protect( atomic_not_null< T * > const & src ) gsl_noexcept
+        {
+            not_null< T * > ptr = src.load();
+            for ( ;; )
+            {
+                domain_.hazards_[ index_ ].store( as_nullable( ptr ) );
+                not_null< T * > current = src.load();
+                if ( current == ptr )
+                {
+                    return ptr;
+                }
+                ptr = current;
+            }
+        }
 
-template<>
-class extent_type< dynamic_extent >
-{
-public:
-    typedef gsl_CONFIG_SPAN_INDEX_TYPE size_type;
+    gsl_is_delete_access:
+        guard( guard const & ) gsl_is_delete;
+        guard & operator=( guard const & ) gsl_is_delete;
+    };
 
-    template< size_type Other >
-    gsl_api gsl_constexpr gsl_explicit extent_type( extent_type< Other > ext )
-        : size_( ext.size() )
+    explicit hazard_pointer_domain( Deleter deleter = Deleter() )
+    : deleter_( deleter )
+    {
+        for ( std::size_t i = 0; i != MaxGuards; ++i )
+        {
+            hazards_[ i ].store( gsl_nullptr );
+            in_use_[ i ].store( false );
+        }
+    }
+    ~hazard_pointer_domain()
     {
+        for ( std::size_t i = 0; i != retired_.size(); ++i )
+        {
+            deleter_( retired_[ i ] );
+        }
     }
 
-    gsl_api gsl_constexpr14 gsl_explicit extent_type( size_type size )
-        : size_( size )
+    // Schedules an object which is no longer reachable through any `atomic_not_null<>` for deletion.
+    void
+    retire( not_null< T * > ptr )
     {
-        gsl_Expects( size != dynamic_extent );
+        retired_.push_back( as_nullable( ptr ) );
+        if ( retired_.size() >= 2 * MaxGuards )
+        {
+            reclaim();
+        }
     }
 
-    gsl_api gsl_constexpr size_type size() const gsl_noexcept { return size_; }
+    // Deletes all retired objects which are not protected by a guard.
+    void
+    reclaim()
+    {
+        std::size_t kept = 0;
+        for ( std::size_t i = 0; i != retired_.size(); ++i )
+        {
+            if ( is_protected( retired_[ i ] ) )
+            {
+                retired_[ kept++ ] = retired_[ i ];
+            }
+            else
+            {
+                deleter_( retired_[ i ] );
+            }
+        }
+        retired_.resize( kept );
+    }
 
-private:
-    size_type size_;
+gsl_is_delete_access:
+    hazard_pointer_domain( hazard_pointer_domain const & ) gsl_is_delete;
+    hazard_pointer_domain & operator=( hazard_pointer_domain const & ) gsl_is_delete;
 };
 
-template< gsl_CONFIG_SPAN_INDEX_TYPE Ext >
-gsl_api gsl_constexpr14 extent_type< Ext >::extent_type( extent_type< dynamic_extent > ext )
-{
-    gsl_Expects( ext.size() == Ext );
-}
+#endif // gsl_FEATURE( EXPERIMENTAL_ATOMIC_NOT_NULL ) && gsl_STDLIB_CPP11_OR_GREATER
 
-template< class T, gsl_CONFIG_SPAN_INDEX_TYPE Extent, gsl_CONFIG_SPAN_INDEX_TYPE Offset, gsl_CONFIG_SPAN_INDEX_TYPE Count >
-struct calculate_subspan_type
-{
-    typedef span< T, Count != dynamic_extent
-                        ? Count
-                        : ( Extent != dynamic_extent ? Extent - Offset : Extent ) > type;
-};
+// print not_null
 
-template< class T, class U, gsl_CONFIG_SPAN_INDEX_TYPE Extent, bool StaticExtent >
-struct calculate_recast_span_type_0
-{
-    typedef span< U, dynamic_extent > type;
-};
-template< class T, class U, gsl_CONFIG_SPAN_INDEX_TYPE Extent >
-struct calculate_recast_span_type_0< T, U, Extent, true >
-{
-    typedef span< U, Extent * sizeof( T ) / sizeof( U ) > type;
-};
-template< class T, class U, gsl_CONFIG_SPAN_INDEX_TYPE Extent >
-struct calculate_recast_span_type : calculate_recast_span_type_0< T, U, Extent, Extent != dynamic_extent >
+template< class CharType, class Traits, class T >
+gsl_TRAILING_RETURN_TYPE_2_( std::basic_ostream< CharType, Traits > & )
+operator<<( std::basic_ostream< CharType, Traits > & os, not_null<T> const & p )
+gsl_RETURN_DECLTYPE_( os << p.operator->() )
 {
-};
+    return os << p.operator->();
+}
 
-} // namespace detail
 
-// [span], class template span
-template< class T, gsl_CONFIG_SPAN_INDEX_TYPE Extent >
-class span
+#if gsl_HAVE( VARIADIC_TEMPLATE )
+# if gsl_HAVE( UNIQUE_PTR )
+template< class T, class... Args >
+gsl_NODISCARD not_null<std::unique_ptr<T>>
+make_unique( Args &&... args )
 {
-public:
-    // constants and types
-    typedef T element_type;
-    typedef typename std11::remove_cv< T >::type value_type;
-    typedef gsl_CONFIG_SPAN_INDEX_TYPE size_type;
-    typedef gsl_CONFIG_SPAN_INDEX_TYPE index_type;
-    typedef element_type * pointer;
-    typedef element_type const * const_pointer;
-    typedef element_type & reference;
-    typedef element_type const & const_reference;
-    typedef std::ptrdiff_t difference_type;
+#  if gsl_HAVE( TYPE_TRAITS )
+    static_assert( !std::is_array<T>::value, "gsl_lite::make_unique<T>() returns `gsl_lite::not_null<std::unique_ptr<T>>`, which is not "
+        "defined for array types because the Core Guidelines advise against pointer arithmetic, cf. \"Bounds safety profile\"." );
+#  endif
+    return not_null<std::unique_ptr<T>>( new T( std::forward<Args>( args )... ) );
+}
+# endif // gsl_HAVE( UNIQUE_PTR )
+# if gsl_HAVE( SHARED_PTR )
+template< class T, class... Args >
+gsl_NODISCARD not_null<std::shared_ptr<T>>
+make_shared( Args &&... args )
+{
+#  if gsl_HAVE( TYPE_TRAITS )
+    static_assert( !std::is_array<T>::value, "gsl_lite::make_shared<T>() returns `gsl_lite::not_null<std::shared_ptr<T>>`, which is not "
+        "defined for array types because the Core Guidelines advise against pointer arithmetic, cf. \"Bounds safety profile\"." );
+#  endif
+    return not_null<std::shared_ptr<T>>( std::make_shared<T>( std::forward<Args>( args )... ) );
+}
+# endif // gsl_HAVE( SHARED_PTR )
+#endif // gsl_HAVE( VARIADIC_TEMPLATE )
 
-    typedef detail::span_iterator< T > iterator;
-    typedef detail::span_iterator< T const > const_iterator;
-    typedef std::reverse_iterator< iterator > reverse_iterator;
-    typedef std::reverse_iterator< const_iterator > const_reverse_iterator;
+#if gsl_FEATURE( EXPERIMENTAL_INTRUSIVE_PTR ) && gsl_STDLIB_CPP11_OR_GREATER
 
-# if gsl_CPP17_OR_GREATER
-    static constexpr size_type extent{ Extent };
-# else
-    static gsl_constexpr const size_type extent = Extent;
-# endif
+//
+// intrusive_ptr<> - Shared ownership of an object which maintains its own reference count.
+//
 
-    // [span.cons], span constructors, copy, assignment, and destructor
-# if gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( DEFAULT_FUNCTION_TEMPLATE_ARG )
-    template<
-        gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
-        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
-        gsl_ENABLE_IF_NTTP_(( detail::is_allowed_extent_conversion< 0, MyExtent >::value ))
-    >
-# endif // gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( DEFAULT_FUNCTION_TEMPLATE_ARG )
-    gsl_api gsl_constexpr span() gsl_noexcept
-        : storage_( detail::extent_type< 0 >( ) )
+// Reference counting policies for `intrusive_ref_counter<>`:
+
+struct thread_unsafe_counter
+{
+    typedef long type;
+
+    static long load( type const & count ) gsl_noexcept { return count; }
+    static void increment( type & count ) gsl_noexcept { ++count; }
+    static bool decrement( type & count ) gsl_noexcept { return --count == 0; }
+};
+
+struct thread_safe_counter
+{
+    typedef std::atomic<long> type;
+
+    static long load( type const & count ) gsl_noexcept { return count.load( std::memory_order_relaxed ); }
+    static void increment( type & count ) gsl_noexcept { count.fetch_add( 1, std::memory_order_relaxed ); }
+    static bool decrement( type & count ) gsl_noexcept { return count.fetch_sub( 1, std::memory_order_acq_rel ) == 1; }
+};
+
+// Base class which embeds the reference count in `Derived`. The count is not copied along with the object.
+// Other classes can be used with `intrusive_ptr<>` by providing the functions `intrusive_ptr_add_ref()` and
+// `intrusive_ptr_release()` for them.
+
+template< class Derived, class CounterPolicy = thread_safe_counter >
+class intrusive_ref_counter
+{
+private:
+    mutable typename CounterPolicy::type count_;
+
+public:
+    gsl_NODISCARD long
+    use_count() const gsl_noexcept
     {
+        return CounterPolicy::load( count_ );
     }
 
-# if gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( DEFAULT_FUNCTION_TEMPLATE_ARG ) && ! gsl_BETWEEN( gsl_COMPILER_MSVC_VERSION, 1, 140 )
-    template<
-        gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
-        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
-        gsl_ENABLE_IF_NTTP_(( MyExtent != dynamic_extent ))
-    >
-    gsl_api gsl_constexpr14 gsl_explicit span( pointer ptr, size_type count )
-        : storage_( ptr, count )
+    friend void
+    intrusive_ptr_add_ref( intrusive_ref_counter const * p ) gsl_noexcept
     {
-        gsl_Expects( count == Extent );
+        CounterPolicy::increment( p->count_ );
     }
-    template<
-        gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
-        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
-        gsl_ENABLE_IF_NTTP_(( MyExtent == dynamic_extent ))
-    >
-    gsl_api gsl_constexpr14 span( pointer ptr, size_type count )
-        : storage_( ptr, count )
+    friend void
+    intrusive_ptr_release( intrusive_ref_counter const * p ) gsl_noexcept
     {
+        if ( CounterPolicy::decrement( p->count_ ) )
+        {
+            delete static_cast< Derived const * >( p );
+        }
     }
 
-    template<
-        gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
-        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
-        gsl_ENABLE_IF_NTTP_(( MyExtent != dynamic_extent ))
-    >
-    gsl_api gsl_constexpr14 gsl_explicit span( iterator it, size_type count )
-        : storage_( it.current_, count )
+protected:
+    intrusive_ref_counter() gsl_noexcept
+    : count_( 0 )
     {
-        gsl_Expects( count == Extent );
-        gsl_Expects( it.end_ - it.current_ == static_cast< difference_type >( Extent ) );
     }
-    template<
-        gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
-        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
-        gsl_ENABLE_IF_NTTP_(( MyExtent == dynamic_extent ))
-    >
-    gsl_api gsl_constexpr14 span( iterator it, size_type count )
-        : storage_( it.current_, count )
+    intrusive_ref_counter( intrusive_ref_counter const & ) gsl_noexcept
+    : count_( 0 )
     {
-        gsl_Expects( it.end_ - it.current_ >= static_cast< difference_type >( count ) );
     }
+    intrusive_ref_counter &
+    operator=( intrusive_ref_counter const & ) gsl_noexcept
+    {
+        return *this;
+    }
+    ~intrusive_ref_counter() = default;
+};
 
-    template<
-        gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
-        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
-        gsl_ENABLE_IF_NTTP_(( MyExtent != dynamic_extent ))
-    >
-    gsl_api gsl_constexpr14 gsl_explicit span( pointer firstElem, pointer lastElem )
-        : storage_( firstElem, gsl_lite::narrow_cast< size_type >( lastElem - firstElem ) )
+template< class T >
+class intrusive_ptr
+{
+private:
+    T * ptr_;
+
+    template< class U > friend class intrusive_ptr;
+
+public:
+    typedef T element_type;
+
+    gsl_constexpr intrusive_ptr() gsl_noexcept
+    : ptr_( gsl_nullptr )
     {
-        gsl_Expects( lastElem - firstElem == static_cast< difference_type >( Extent ) );
     }
-    template<
-        gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
-        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
-        gsl_ENABLE_IF_NTTP_(( MyExtent == dynamic_extent ))
-    >
-    gsl_api gsl_constexpr14 span( pointer firstElem, pointer lastElem )
-        : storage_( firstElem, gsl_lite::narrow_cast< size_type >( lastElem - firstElem ) )
+    gsl_constexpr intrusive_ptr( std::nullptr_t ) gsl_noexcept
+    : ptr_( gsl_nullptr )
     {
-        gsl_Expects( firstElem <= lastElem );
     }
-
-    template<
-        gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
-        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
-        gsl_ENABLE_IF_NTTP_(( MyExtent != dynamic_extent ))
-    >
-    gsl_api gsl_constexpr14 gsl_explicit span( iterator firstElem, iterator lastElem )
-        : storage_( firstElem.current_, gsl_lite::narrow_cast< size_type >( lastElem - firstElem ) )
+    explicit intrusive_ptr( T * p, bool add_ref = true ) gsl_noexcept
+    : ptr_( p )
     {
-        gsl_Expects( lastElem - firstElem == static_cast< difference_type >( Extent ) );
+        if ( ptr_ != gsl_nullptr && add_ref )
+        {
+            intrusive_ptr_add_ref( ptr_ );
+        }
     }
-    template<
-        gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
-        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
-        gsl_ENABLE_IF_NTTP_(( MyExtent == dynamic_extent ))
-    >
-    gsl_api gsl_constexpr14 span( iterator firstElem, iterator lastElem )
-        : storage_( firstElem.current_, gsl_lite::narrow_cast< size_type >( lastElem - firstElem ) )
+    intrusive_ptr( intrusive_ptr const & other ) gsl_noexcept
+    : ptr_( other.ptr_ )
     {
-        gsl_Expects( firstElem <= lastElem );
+        if ( ptr_ != gsl_nullptr )
+        {
+            intrusive_ptr_add_ref( ptr_ );
+        }
     }
-# else // !( gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( DEFAULT_FUNCTION_TEMPLATE_ARG ) && ! gsl_BETWEEN( gsl_COMPILER_MSVC_VERSION, 1, 140 ) )
-    gsl_api gsl_constexpr14 span( pointer ptr, size_type count )
-        : storage_( ptr, count )
+    intrusive_ptr( intrusive_ptr && other ) gsl_noexcept
+    : ptr_( other.ptr_ )
     {
-        gsl_Expects( Extent == dynamic_extent || count == Extent );
+        other.ptr_ = gsl_nullptr;
     }
-    gsl_api gsl_constexpr14 span( iterator it, size_type count )
-        : storage_( it.current_, count )
+    template< class U
+        gsl_ENABLE_IF_(( std::is_convertible<U *, T *>::value ))
+    >
+    intrusive_ptr( intrusive_ptr<U> const & other ) gsl_noexcept
+    : ptr_( other.ptr_ )
     {
-        gsl_Expects( Extent == dynamic_extent || count == Extent );
-        gsl_Expects( it.end_ - it.current_ >= static_cast< difference_type >( count ) );
+        if ( ptr_ != gsl_nullptr )
+        {
+            intrusive_ptr_add_ref( ptr_ );
+        }
     }
-    gsl_api gsl_constexpr14 span( pointer firstElem, pointer lastElem )
-        : storage_( firstElem, gsl_lite::narrow_cast< size_type >( lastElem - firstElem ) )
+    template< class U
+        gsl_ENABLE_IF_(( std::is_convertible<U *, T *>::value ))
+    >
+    intrusive_ptr( intrusive_ptr<U> && other ) gsl_noexcept
+    : ptr_( other.ptr_ )
     {
-        gsl_Expects( firstElem <= lastElem );
-        gsl_Expects( Extent == dynamic_extent || lastElem - firstElem == static_cast< difference_type >( Extent ) );
+        other.ptr_ = gsl_nullptr;
     }
-    gsl_api gsl_constexpr14 span( iterator firstElem, iterator lastElem )
-        : storage_( firstElem.current_, gsl_lite::narrow_cast< size_type >( lastElem - firstElem ) )
+    ~intrusive_ptr()
     {
-        gsl_Expects( firstElem <= lastElem );
-        gsl_Expects( Extent == dynamic_extent || lastElem - firstElem == static_cast< difference_type >( Extent ) );
+        if ( ptr_ != gsl_nullptr )
+        {
+            intrusive_ptr_release( ptr_ );
+        }
     }
-# endif // gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( DEFAULT_FUNCTION_TEMPLATE_ARG ) && ! gsl_BETWEEN( gsl_COMPILER_MSVC_VERSION, 1, 140 )
 
-    template<
-        class U, std::size_t N
-        gsl_ENABLE_IF_(( detail::is_allowed_extent_conversion< N, Extent >::value &&
-                         detail::is_allowed_element_type_conversion< U, element_type >::value ))
-    >
-    gsl_api gsl_constexpr span( U (&arr)[N] ) gsl_noexcept
-        : storage_( known_not_null( arr ), detail::extent_type< N >( ) )
+    intrusive_ptr &
+    operator=( intrusive_ptr other ) gsl_noexcept
     {
+        swap( other );
+        return *this;
     }
 
-# if gsl_HAVE( ARRAY )
-    template<
-        class U, std::size_t N
-        gsl_ENABLE_IF_(( detail::is_allowed_extent_conversion< N, Extent >::value &&
-                         detail::is_allowed_element_type_conversion< U, element_type >::value ))
-    >
-    gsl_api gsl_constexpr span( std::array<U, N> & arr ) gsl_noexcept
-        : storage_( known_not_null( arr.data() ), detail::extent_type< N >( ) )
+    void
+    reset() gsl_noexcept
     {
+        intrusive_ptr().swap( *this );
     }
-    template<
-        class U, std::size_t N
-        gsl_ENABLE_IF_(( detail::is_allowed_extent_conversion< N, Extent >::value &&
-                         detail::is_allowed_element_type_conversion< U const , element_type >::value ))
-    >
-    gsl_api gsl_constexpr span( std::array<U, N> const & arr ) gsl_noexcept
-        : storage_( known_not_null( arr.data() ), detail::extent_type< N >( ) )
+    void
+    reset( T * p, bool add_ref = true ) gsl_noexcept
     {
+        intrusive_ptr( p, add_ref ).swap( *this );
     }
-# endif // gsl_HAVE( ARRAY )
-
-# if gsl_HAVE( CONSTRAINED_SPAN_CONTAINER_CTOR )
-#  if ! gsl_BETWEEN( gsl_COMPILER_MSVC_VERSION, 1, 140 )
-    template< class Container, gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
-        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
-        gsl_ENABLE_IF_NTTP_(( MyExtent != dynamic_extent &&
-                              detail::is_compatible_container< Container, element_type >::value ))
-    >
-    gsl_api gsl_constexpr gsl_explicit span( Container & cont ) gsl_noexcept
-        : storage_( std17::data( cont ), std17::size( cont ) )
+    // Releases ownership without decrementing the reference count.
+    gsl_NODISCARD T *
+    detach() gsl_noexcept
     {
+        T * result = ptr_;
+        ptr_ = gsl_nullptr;
+        return result;
     }
-    template< class Container, gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
-        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
-        gsl_ENABLE_IF_NTTP_(( MyExtent == dynamic_extent &&
-                              detail::is_compatible_container< Container, element_type >::value ))
-    >
-    gsl_api gsl_constexpr span( Container & cont ) gsl_noexcept
-        : storage_( std17::data( cont ), std17::size( cont ) )
+    void
+    swap( intrusive_ptr & other ) gsl_noexcept
     {
+        T * tmp = ptr_;
+        ptr_ = other.ptr_;
+        other.ptr_ = tmp;
     }
 
-    template< class Container, gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
-        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
-        gsl_ENABLE_IF_NTTP_(( MyExtent != dynamic_extent &&
-                              std::is_const< element_type >::value &&
-                              detail::is_compatible_container< Container, element_type >::value ))
-    >
-    gsl_api gsl_constexpr gsl_explicit span( Container const & cont ) gsl_noexcept
-        : storage_( std17::data( cont ), std17::size( cont ) )
+    gsl_NODISCARD gsl_constexpr T *
+    get() const gsl_noexcept
     {
+        return ptr_;
     }
-    template< class Container, gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
-        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
-        gsl_ENABLE_IF_NTTP_(( MyExtent == dynamic_extent &&
-                              std::is_const< element_type >::value &&
-                              detail::is_compatible_container< Container, element_type >::value ))
-    >
-    gsl_api gsl_constexpr span( Container const & cont ) gsl_noexcept
-        : storage_( std17::data( cont ), std17::size( cont ) )
+    gsl_NODISCARD gsl_constexpr T *
+    operator->() const gsl_noexcept
+    {
+        return ptr_;
+    }
+    gsl_NODISCARD gsl_constexpr T &
+    operator*() const gsl_noexcept
+    {
+        return *ptr_;
+    }
+    gsl_NODISCARD gsl_constexpr explicit
+    operator bool() const gsl_noexcept
+    {
+        return ptr_ != gsl_nullptr;
+    }
+};
+
+template< class T >
+void
+swap( intrusive_ptr<T> & lhs, intrusive_ptr<T> & rhs ) gsl_noexcept
+{
+    lhs.swap( rhs );
+}
+
+template< class T, class U >
+gsl_NODISCARD gsl_constexpr bool
+operator==( intrusive_ptr<T> const & lhs, intrusive_ptr<U> const & rhs ) gsl_noexcept
+{
+    return lhs.get() == rhs.get();
+}
+template< class T, class U >
+gsl_NODISCARD gsl_constexpr bool
+operator!=( intrusive_ptr<T> const & lhs, intrusive_ptr<U> const & rhs ) gsl_noexcept
+{
+    return lhs.get() != rhs.get();
+}
+template< class T >
+gsl_NODISCARD gsl_constexpr bool
+operator==( intrusive_ptr<T> const & lhs, std::nullptr_t ) gsl_noexcept
+{
+    return lhs.get() == gsl_nullptr;
+}
+template< class T >
+gsl_NODISCARD gsl_constexpr bool
+operator==( std::nullptr_t, intrusive_ptr<T> const & rhs ) gsl_noexcept
+{
+    return rhs.get() == gsl_nullptr;
+}
+template< class T >
+gsl_NODISCARD gsl_constexpr bool
+operator!=( intrusive_ptr<T> const & lhs, std::nullptr_t ) gsl_noexcept
+{
+    return lhs.get() != gsl_nullptr;
+}
+template< class T >
+gsl_NODISCARD gsl_constexpr bool
+operator!=( std::nullptr_t, intrusive_ptr<T> const & rhs ) gsl_noexcept
+{
+    return rhs.get() != gsl_nullptr;
+}
+
+template< class T, class... Args >
+gsl_NODISCARD not_null< intrusive_ptr<T> >
+make_not_null_intrusive( Args &&... args )
+{
+    static_assert( !std::is_array<T>::value, "gsl_lite::make_not_null_intrusive<T>() returns `gsl_lite::not_null<gsl_lite::intrusive_ptr<T>>`, "
+        "which is not defined for array types because the Core Guidelines advise against pointer arithmetic, cf. \"Bounds safety profile\"." );
+    return detail::not_null_accessor< intrusive_ptr<T> >::make_unchecked( intrusive_ptr<T>( new T( std::forward<Args>( args )... ) ) );
+}
+
+#endif // gsl_FEATURE( EXPERIMENTAL_INTRUSIVE_PTR ) && gsl_STDLIB_CPP11_OR_GREATER
+
+
+#if gsl_FEATURE( BYTE )
+//
+// Byte-specific type.
+//
+# if gsl_HAVE( ENUM_CLASS_CONSTRUCTION_FROM_UNDERLYING_TYPE )
+  enum class gsl_may_alias byte : unsigned char {};
+# else
+#  if ! defined( gsl_CONFIG_ACKNOWLEDGE_NONSTANDARD_ABI )
+#   pragma message (__FILE__ "(" gsl_STRINGIFY( __LINE__ ) "): warning: in pre-C++11 mode, byte is defined as a struct rather than an enum, which changes the ABI of gsl-lite and may lead to ODR violations and undefined behavior; define the macro gsl_CONFIG_ACKNOWLEDGE_NONSTANDARD_ABI to explicitly acknowledge that you are using gsl-lite with a non-standard ABI and that you control the build flags of all components linked into your target")
+#  endif
+  struct gsl_may_alias byte { typedef unsigned char type; type v; };
+# endif
+
+template< class T >
+gsl_NODISCARD gsl_api inline gsl_constexpr byte
+to_byte( T v ) gsl_noexcept
+{
+# if    gsl_HAVE( ENUM_CLASS_CONSTRUCTION_FROM_UNDERLYING_TYPE )
+    return static_cast<byte>( v );
+# elif  gsl_HAVE( CONSTEXPR_11 )
+    return { static_cast<typename byte::type>( v ) };
+# else
+    byte b = { static_cast<typename byte::type>( v ) }; return b;
+# endif
+}
+
+template< class IntegerType  gsl_ENABLE_IF_(( std::is_integral<IntegerType>::value )) >
+gsl_NODISCARD gsl_api inline gsl_constexpr IntegerType
+to_integer( byte b ) gsl_noexcept
+{
+# if gsl_HAVE( ENUM_CLASS_CONSTRUCTION_FROM_UNDERLYING_TYPE )
+    return static_cast<typename std::underlying_type<byte>::type>( b );
+# else
+    return b.v;
+# endif
+}
+
+gsl_NODISCARD gsl_api inline gsl_constexpr unsigned char
+to_uchar( byte b ) gsl_noexcept
+{
+    return to_integer<unsigned char>( b );
+}
+
+gsl_NODISCARD gsl_api inline gsl_constexpr unsigned char
+to_uchar( int i ) gsl_noexcept
+{
+    return static_cast<unsigned char>( i );
+}
+
+template< class IntegerType  gsl_ENABLE_IF_(( std::is_integral<IntegerType>::value )) >
+gsl_api inline gsl_constexpr14 byte &
+operator<<=( byte & b, IntegerType shift ) gsl_noexcept
+{
+# if gsl_HAVE( ENUM_CLASS_CONSTRUCTION_FROM_UNDERLYING_TYPE )
+    return b = ::gsl_lite::to_byte( ::gsl_lite::to_uchar( b ) << shift );
+# else
+    b.v = ::gsl_lite::to_uchar( b.v << shift ); return b;
+# endif
+}
+
+template< class IntegerType  gsl_ENABLE_IF_(( std::is_integral<IntegerType>::value )) >
+gsl_NODISCARD gsl_api inline gsl_constexpr byte
+operator<<( byte b, IntegerType shift ) gsl_noexcept
+{
+    return ::gsl_lite::to_byte( ::gsl_lite::to_uchar( b ) << shift );
+}
+
+template< class IntegerType  gsl_ENABLE_IF_(( std::is_integral<IntegerType>::value )) >
+gsl_NODISCARD gsl_api inline gsl_constexpr14 byte &
+operator>>=( byte & b, IntegerType shift ) gsl_noexcept
+{
+# if gsl_HAVE( ENUM_CLASS_CONSTRUCTION_FROM_UNDERLYING_TYPE )
+    return b = ::gsl_lite::to_byte( ::gsl_lite::to_uchar( b ) >> shift );
+# else
+    b.v = ::gsl_lite::to_uchar( b.v >> shift ); return b;
+# endif
+}
+
+template< class IntegerType  gsl_ENABLE_IF_(( std::is_integral<IntegerType>::value )) >
+gsl_NODISCARD gsl_api inline gsl_constexpr byte
+operator>>( byte b, IntegerType shift ) gsl_noexcept
+{
+    return ::gsl_lite::to_byte( ::gsl_lite::to_uchar( b ) >> shift );
+}
+
+# if gsl_HAVE( ENUM_CLASS_CONSTRUCTION_FROM_UNDERLYING_TYPE )
+gsl_DEFINE_ENUM_BITMASK_OPERATORS( byte )
+gsl_DEFINE_ENUM_RELATIONAL_OPERATORS( byte )
+# else // a.k.a. !gsl_HAVE( ENUM_CLASS_CONSTRUCTION_FROM_UNDERLYING_TYPE )
+gsl_api inline gsl_constexpr bool operator==( byte l, byte r ) gsl_noexcept
+{
+    return l.v == r.v;
+}
+
+gsl_api inline gsl_constexpr bool operator!=( byte l, byte r ) gsl_noexcept
+{
+    return !( l == r );
+}
+
+gsl_api inline gsl_constexpr bool operator< ( byte l, byte r ) gsl_noexcept
+{
+    return l.v < r.v;
+}
+
+gsl_api inline gsl_constexpr bool operator<=( byte l, byte r ) gsl_noexcept
+{
+    return !( r < l );
+}
+
+gsl_api inline gsl_constexpr bool operator> ( byte l, byte r ) gsl_noexcept
+{
+    return ( r < l );
+}
+
+gsl_api inline gsl_constexpr bool operator>=( byte l, byte r ) gsl_noexcept
+{
+    return !( l < r );
+}
+
+gsl_api inline gsl_constexpr14 byte & operator|=( byte & l, byte r ) gsl_noexcept
+{
+    l.v |= r.v; return l;
+}
+
+gsl_api inline gsl_constexpr byte operator|( byte l, byte r ) gsl_noexcept
+{
+    return ::gsl_lite::to_byte( l.v | r.v );
+}
+
+gsl_api inline gsl_constexpr14 byte & operator&=( byte & l, byte r ) gsl_noexcept
+{
+    l.v &= r.v; return l;
+}
+
+gsl_api inline gsl_constexpr byte operator&( byte l, byte r ) gsl_noexcept
+{
+    return ::gsl_lite::to_byte( l.v & r.v );
+}
+
+gsl_api inline gsl_constexpr14 byte & operator^=( byte & l, byte r ) gsl_noexcept
+{
+    l.v ^= r.v; return l;
+}
+
+gsl_api inline gsl_constexpr byte operator^( byte l, byte r ) gsl_noexcept
+{
+    return ::gsl_lite::to_byte( l.v ^ r.v );
+}
+
+gsl_api inline gsl_constexpr byte operator~( byte b ) gsl_noexcept
+{
+    return ::gsl_lite::to_byte( ~b.v );
+}
+# endif // gsl_HAVE( ENUM_CLASS_CONSTRUCTION_FROM_UNDERLYING_TYPE )
+#endif // gsl_FEATURE( BYTE )
+
+#if gsl_FEATURE_TO_STD( WITH_CONTAINER )
+
+// Tag to select span constructor taking a container:
+
+struct with_container_t { gsl_constexpr with_container_t( ) gsl_noexcept { } };
+const  gsl_constexpr   with_container_t with_container; // TODO: this can lead to ODR violations because the symbol will be defined in multiple translation units
+
+#endif
+
+
+#if gsl_FEATURE( SPAN )
+// The span<> and span_iterator<> implementation below was mostly borrowed from Microsoft GSL.
+
+
+# if gsl_COMPILER_MSVC_VER
+#  pragma warning( push )
+
+// turn off some warnings that are noisy about our Expects statements
+#  pragma warning( disable : 4127 ) // conditional expression is constant
+#  pragma warning( disable : 4146 ) // unary minus operator applied to unsigned type, result still unsigned
+#  pragma warning( disable : 4702 ) // unreachable code
+
+// Turn off MSVC /analyze rules that generate too much noise
+#  pragma warning( disable : 26495 ) // uninitialized member when constructor calls constructor
+#  pragma warning( disable : 26446 ) // parser bug does not allow attributes on some templates
+
+# endif // gsl_COMPILER_MSVC_VER
+
+// GCC 7 does not like the signed unsigned mismatch (size_t ptrdiff_t)
+// While there is a conversion from signed to unsigned, it happens at
+// compiletime, so the compiler wouldn't have to warn indiscriminately, but
+// could check if the source value actually doesn't fit into the target type
+// and only warn in those cases.
+# if defined( __GNUC__ ) && __GNUC__ > 6
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wsign-conversion"
+# endif // defined( __GNUC__ ) && __GNUC__ > 6
+
+// Turn off clang unsafe buffer warnings as all accessed are guarded by runtime checks
+# if defined( __clang__ )
+#  if __has_warning( "-Wunsafe-buffer-usage" )
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wunsafe-buffer-usage"
+#  endif // __has_warning( "-Wunsafe-buffer-usage" )
+# endif // defined( __clang__ )
+
+namespace detail {
+
+template< gsl_CONFIG_SPAN_INDEX_TYPE From, gsl_CONFIG_SPAN_INDEX_TYPE To >
+struct is_allowed_extent_conversion
+    : std17::bool_constant< From == To || To == dynamic_extent >
+{
+};
+
+# if gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( DEFAULT_FUNCTION_TEMPLATE_ARG )
+template< class From, class To >
+struct is_allowed_element_type_conversion
+    : std17::bool_constant< std::is_convertible< From (*)[], To (*)[] >::value >
+{
+};
+# endif // gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( DEFAULT_FUNCTION_TEMPLATE_ARG )
+
+template< class T >
+class span_iterator
+{
+public:
+# if gsl_STDLIB_CPP20_OR_GREATER
+    typedef typename std::contiguous_iterator_tag iterator_concept;
+# endif // gsl_STDLIB_CPP20_OR_GREATER
+    typedef typename std::random_access_iterator_tag iterator_category;
+    typedef typename std11::remove_cv< T >::type value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef T * pointer;
+    typedef T & reference;
+
+# ifdef gsl_COMPILER_MS_STL_VERSION
+    typedef pointer _Unchecked_type;
+    typedef span_iterator _Prevent_inheriting_unwrap;
+# endif // gsl_COMPILER_MS_STL_VERSION
+# if gsl_HAVE( IS_DEFAULT )
+    gsl_constexpr span_iterator() = default;
+# else // ! gsl_HAVE( IS_DEFAULT )
+    gsl_api gsl_constexpr span_iterator() gsl_noexcept
+        : begin_( gsl_nullptr ), end_( gsl_nullptr ), current_( gsl_nullptr )
+    {
+    }
+# endif // gsl_HAVE( IS_DEFAULT )
+
+    gsl_api gsl_constexpr14 span_iterator( pointer begin, pointer end, pointer current )
+        : begin_( begin ), end_( end ), current_( current )
+    {
+        gsl_ExpectsDebug( begin_ <= current_ && current <= end_ );
+    }
+
+    gsl_api gsl_constexpr14 operator span_iterator< T const >() const gsl_noexcept
+    {
+        return span_iterator< T const >( begin_, end_, current_ );
+    }
+
+    gsl_api gsl_constexpr14 reference operator*() const
+    {
+        gsl_ExpectsDebug( current_ != end_ );
+        return *current_;
+    }
+
+    gsl_api gsl_constexpr14 pointer operator->() const
+    {
+        gsl_ExpectsDebug( current_ != end_ );
+        return current_;
+    }
+    gsl_api gsl_constexpr14 span_iterator& operator++()
+    {
+        gsl_ExpectsDebug( current_ != end_ );
+        gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
+        ++current_;
+        return *this;
+    }
+
+    gsl_api gsl_constexpr14 span_iterator operator++( int )
+    {
+        span_iterator ret = *this;
+        ++*this;
+        return ret;
+    }
+
+    gsl_api gsl_constexpr14 span_iterator& operator--()
+    {
+        gsl_ExpectsDebug( begin_ != current_ );
+        --current_;
+        return *this;
+    }
+
+    gsl_api gsl_constexpr14 span_iterator operator--( int )
+    {
+        span_iterator ret = *this;
+        --*this;
+        return ret;
+    }
+
+    gsl_api gsl_constexpr14 span_iterator& operator+=( difference_type const n )
+    {
+        if ( n != 0 ) gsl_ExpectsDebug( begin_ && current_ && end_ );
+        if ( n > 0 )  gsl_ExpectsDebug( end_ - current_ >= n );
+        if ( n < 0 )  gsl_ExpectsDebug( current_ - begin_ >= -n );
+        gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
+        current_ += n;
+        return *this;
+    }
+
+    gsl_api gsl_constexpr14 span_iterator operator+( difference_type const n ) const
+    {
+        span_iterator ret = *this;
+        ret += n;
+        return ret;
+    }
+
+    friend gsl_api gsl_constexpr14 span_iterator operator+( difference_type const n,
+                                                            span_iterator const & rhs )
+    {
+        return rhs + n;
+    }
+
+    gsl_api gsl_constexpr14 span_iterator& operator-=( difference_type const n )
+    {
+        if ( n != 0 ) gsl_ExpectsDebug( begin_ && current_ && end_ );
+        if ( n > 0 )  gsl_ExpectsDebug( current_ - begin_ >= n );
+        if ( n < 0 )  gsl_ExpectsDebug( end_ - current_ >= -n );
+        gsl_SUPPRESS_MSGSL_WARNING(bounds .1)
+        current_ -= n;
+        return *this;
+    }
+
+    gsl_api gsl_constexpr14 span_iterator operator-( difference_type const n ) const
+    {
+        span_iterator ret = *this;
+        ret -= n;
+        return ret;
+    }
+
+    template<
+        class U
+        gsl_ENABLE_IF_(( std::is_same< typename std::remove_cv< U >::type, value_type >::value ))
+    >
+    gsl_api gsl_constexpr14 difference_type operator-( span_iterator< U > const & rhs ) const
+    {
+        gsl_ExpectsDebug( begin_ == rhs.begin_ && end_ == rhs.end_ );
+        return current_ - rhs.current_;
+    }
+
+    gsl_api gsl_constexpr14 reference operator[]( difference_type const n ) const
+    {
+        return *( *this + n );
+    }
+
+    template<
+        class U
+        gsl_ENABLE_IF_(( std::is_same< typename std::remove_cv< U >::type, value_type >::value ))
+    >
+    gsl_api gsl_constexpr14 bool operator==( span_iterator< U > const & rhs ) const
+    {
+        gsl_ExpectsDebug( begin_ == rhs.begin_ && end_ == rhs.end_ );
+        return current_ == rhs.current_;
+    }
+
+    template<
+        class U
+        gsl_ENABLE_IF_(( std::is_same< typename std::remove_cv< U >::type, value_type >::value ))
+    >
+    gsl_api gsl_constexpr14 bool operator!=( span_iterator< U > const & rhs ) const
+    {
+        return !( *this == rhs );
+    }
+
+    template<
+        class U
+        gsl_ENABLE_IF_(( std::is_same< typename std::remove_cv< U >::type, value_type >::value ))
+    >
+    gsl_api gsl_constexpr14 bool operator<( span_iterator< U > const & rhs ) const
+    {
+        gsl_ExpectsDebug( begin_ == rhs.begin_ && end_ == rhs.end_ );
+        return current_ < rhs.current_;
+    }
+
+    template<
+        class U
+        gsl_ENABLE_IF_(( std::is_same< typename std::remove_cv< U >::type, value_type >::value ))
+    >
+    gsl_api gsl_constexpr14 bool operator>( span_iterator< U > const & rhs ) const
+    {
+        return rhs < *this;
+    }
+
+    template<
+        class U
+        gsl_ENABLE_IF_(( std::is_same< typename std::remove_cv< U >::type, value_type >::value ))
+    >
+    gsl_api gsl_constexpr14 bool operator<=( span_iterator< U > const & rhs ) const
+    {
+        return !( rhs < *this );
+    }
+
+    template<
+        class U
+        gsl_ENABLE_IF_(( std::is_same< typename std::remove_cv< U >::type, value_type >::value ))
+    >
+    gsl_api gsl_constexpr14 bool operator>=( span_iterator< U > const & rhs ) const
+    {
+        return !( *this < rhs );
+    }
+
+# ifdef gsl_COMPILER_MS_STL_VERSION
+    // MSVC++ iterator debugging support; allows STL algorithms in 15.8+
+    // to unwrap span_iterator to a pointer type after a range check in STL
+    // algorithm calls.
+    friend gsl_api gsl_constexpr14 void _Verify_range( span_iterator lhs, span_iterator rhs ) gsl_noexcept
+    {
+        // test that [lhs, rhs) forms a valid range inside an STL algorithm
+        gsl_Expects( lhs.begin_ == rhs.begin_ // range spans have to match
+                && lhs.end_ == rhs.end_ &&
+                lhs.current_ <= rhs.current_ ); // range must not be transposed
+    }
+
+    gsl_api gsl_constexpr14 void _Verify_offset( difference_type const n ) const gsl_noexcept
+    {
+        // test that *this + n is within the range of this call
+        if ( n != 0 ) gsl_Expects( begin_ && current_ && end_ );
+        if ( n > 0 )  gsl_Expects( end_ - current_ >= n );
+        if ( n < 0 )  gsl_Expects( current_ - begin_ >= -n );
+    }
+
+    gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
+    gsl_api gsl_constexpr14 pointer _Unwrapped() const gsl_noexcept
+    {
+        // after seeking *this to a high water mark, or using one of the
+        // _Verify_xxx functions above, unwrap this span_iterator to a raw
+        // pointer
+        return current_;
+    }
+
+    // Tell the STL that span_iterator should not be unwrapped if it can't
+    // validate in advance, even in release / optimized builds:
+#  if gsl_CPP17_OR_GREATER
+    static constexpr bool _Unwrap_when_unverified = false;
+#  else
+    static gsl_constexpr const bool _Unwrap_when_unverified = false;
+#  endif
+    gsl_SUPPRESS_MSGSL_WARNING(con.3) // TODO: false positive
+    gsl_api gsl_constexpr14 void _Seek_to( pointer const p ) gsl_noexcept
+    {
+        // adjust the position of *this to previously verified location p
+        // after _Unwrapped
+        current_ = p;
+    }
+# endif
+
+# if gsl_HAVE( IS_DEFAULT )
+    pointer begin_ = nullptr;
+    pointer end_ = nullptr;
+    pointer current_ = nullptr;
+# else // ! gsl_HAVE( IS_DEFAULT )
+    pointer begin_;
+    pointer end_;
+    pointer current_;
+# endif // gsl_HAVE( IS_DEFAULT )
+
+# if gsl_STDLIB_CPP11_OR_GREATER
+    template< class Ptr >
+    friend struct std::pointer_traits;
+# endif // gsl_STDLIB_CPP11_OR_GREATER
+};
+
+template< gsl_CONFIG_SPAN_INDEX_TYPE Ext >
+class extent_type
+{
+public:
+    typedef gsl_CONFIG_SPAN_INDEX_TYPE size_type;
+
+# if gsl_HAVE( IS_DEFAULT )
+    gsl_constexpr extent_type() gsl_noexcept = default;
+# else // ! gsl_HAVE( IS_DEFAULT )
+    gsl_constexpr extent_type() gsl_noexcept { }
+# endif // gsl_HAVE( IS_DEFAULT )
+
+    gsl_api gsl_constexpr14 gsl_explicit extent_type( extent_type< dynamic_extent > );
+
+    gsl_api gsl_constexpr14 gsl_explicit extent_type( size_type size ) { gsl_Expects( size == Ext ); }
+
+    gsl_api gsl_constexpr size_type size() const gsl_noexcept { return Ext; }
+
+private:
+# if gsl_CPP17_OR_GREATER
+    static constexpr size_type size_ = Ext; // static size equal to Ext
+# else
+    static gsl_constexpr const size_type size_ = Ext; // static size equal to Ext
+# endif
+};
+
+template<>
+class extent_type< dynamic_extent >
+{
+public:
+    typedef gsl_CONFIG_SPAN_INDEX_TYPE size_type;
+
+    template< size_type Other >
+    gsl_api gsl_constexpr gsl_explicit extent_type( extent_type< Other > ext )
+        : size_( ext.size() )
+    {
+    }
+
+    gsl_api gsl_constexpr14 gsl_explicit extent_type( size_type size )
+        : size_( size )
+    {
+        gsl_Expects( size != dynamic_extent );
+    }
+
+    gsl_api gsl_constexpr size_type size() const gsl_noexcept { return size_; }
+
+private:
+    size_type size_;
+};
+
+template< gsl_CONFIG_SPAN_INDEX_TYPE Ext >
+gsl_api gsl_constexpr14 extent_type< Ext >::extent_type( extent_type< dynamic_extent > ext )
+{
+    gsl_Expects( ext.size() == Ext );
+}
+
+template< class T, gsl_CONFIG_SPAN_INDEX_TYPE Extent, gsl_CONFIG_SPAN_INDEX_TYPE Offset, gsl_CONFIG_SPAN_INDEX_TYPE Count >
+struct calculate_subspan_type
+{
+    typedef span< T, Count != dynamic_extent
+                        ? Count
+                        : ( Extent != dynamic_extent ? Extent - Offset : Extent ) > type;
+};
+
+template< class T, class U, gsl_CONFIG_SPAN_INDEX_TYPE Extent, bool StaticExtent >
+struct calculate_recast_span_type_0
+{
+    typedef span< U, dynamic_extent > type;
+};
+template< class T, class U, gsl_CONFIG_SPAN_INDEX_TYPE Extent >
+struct calculate_recast_span_type_0< T, U, Extent, true >
+{
+    typedef span< U, Extent * sizeof( T ) / sizeof( U ) > type;
+};
+template< class T, class U, gsl_CONFIG_SPAN_INDEX_TYPE Extent >
+struct calculate_recast_span_type : calculate_recast_span_type_0< T, U, Extent, Extent != dynamic_extent >
+{
+};
+
+} // namespace detail
+
+// [span], class template span
+template< class T, gsl_CONFIG_SPAN_INDEX_TYPE Extent >
+class span
+{
+public:
+    // constants and types
+    typedef T element_type;
+    typedef typename std11::remove_cv< T >::type value_type;
+    typedef gsl_CONFIG_SPAN_INDEX_TYPE size_type;
+    typedef gsl_CONFIG_SPAN_INDEX_TYPE index_type;
+    typedef element_type * pointer;
+    typedef element_type const * const_pointer;
+    typedef element_type & reference;
+    typedef element_type const & const_reference;
+    typedef std::ptrdiff_t difference_type;
+
+    typedef detail::span_iterator< T > iterator;
+    typedef detail::span_iterator< T const > const_iterator;
+    typedef std::reverse_iterator< iterator > reverse_iterator;
+    typedef std::reverse_iterator< const_iterator > const_reverse_iterator;
+
+# if gsl_CPP17_OR_GREATER
+    static constexpr size_type extent{ Extent };
+# else
+    static gsl_constexpr const size_type extent = Extent;
+# endif
+
+    // [span.cons], span constructors, copy, assignment, and destructor
+# if gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( DEFAULT_FUNCTION_TEMPLATE_ARG )
+    template<
+        gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
+        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
+        gsl_ENABLE_IF_NTTP_(( detail::is_allowed_extent_conversion< 0, MyExtent >::value ))
+    >
+# endif // gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( DEFAULT_FUNCTION_TEMPLATE_ARG )
+    gsl_api gsl_constexpr span() gsl_noexcept
+        : storage_( detail::extent_type< 0 >( ) )
+    {
+    }
+
+# if gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( DEFAULT_FUNCTION_TEMPLATE_ARG ) && ! gsl_BETWEEN( gsl_COMPILER_MSVC_VERSION, 1, 140 )
+    template<
+        gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
+        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
+        gsl_ENABLE_IF_NTTP_(( MyExtent != dynamic_extent ))
+    >
+    gsl_api gsl_constexpr14 gsl_explicit span( pointer ptr, size_type count )
+        : storage_( ptr, count )
+    {
+        gsl_Expects( count == Extent );
+    }
+    template<
+        gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
+        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
+        gsl_ENABLE_IF_NTTP_(( MyExtent == dynamic_extent ))
+    >
+    gsl_api gsl_constexpr14 span( pointer ptr, size_type count )
+        : storage_( ptr, count )
+    {
+    }
+
+    template<
+        gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
+        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
+        gsl_ENABLE_IF_NTTP_(( MyExtent != dynamic_extent ))
+    >
+    gsl_api gsl_constexpr14 gsl_explicit span( iterator it, size_type count )
+        : storage_( it.current_, count )
+    {
+        gsl_Expects( count == Extent );
+        gsl_Expects( it.end_ - it.current_ == static_cast< difference_type >( Extent ) );
+    }
+    template<
+        gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
+        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
+        gsl_ENABLE_IF_NTTP_(( MyExtent == dynamic_extent ))
+    >
+    gsl_api gsl_constexpr14 span( iterator it, size_type count )
+        : storage_( it.current_, count )
+    {
+        gsl_Expects( it.end_ - it.current_ >= static_cast< difference_type >( count ) );
+    }
+
+    template<
+        gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
+        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
+        gsl_ENABLE_IF_NTTP_(( MyExtent != dynamic_extent ))
+    >
+    gsl_api gsl_constexpr14 gsl_explicit span( pointer firstElem, pointer lastElem )
+        : storage_( firstElem, gsl_lite::narrow_cast< size_type >( lastElem - firstElem ) )
+    {
+        gsl_Expects( lastElem - firstElem == static_cast< difference_type >( Extent ) );
+    }
+    template<
+        gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
+        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
+        gsl_ENABLE_IF_NTTP_(( MyExtent == dynamic_extent ))
+    >
+    gsl_api gsl_constexpr14 span( pointer firstElem, pointer lastElem )
+        : storage_( firstElem, gsl_lite::narrow_cast< size_type >( lastElem - firstElem ) )
+    {
+        gsl_Expects( firstElem <= lastElem );
+    }
+
+    template<
+        gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
+        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
+        gsl_ENABLE_IF_NTTP_(( MyExtent != dynamic_extent ))
+    >
+    gsl_api gsl_constexpr14 gsl_explicit span( iterator firstElem, iterator lastElem )
+        : storage_( firstElem.current_, gsl_lite::narrow_cast< size_type >( lastElem - firstElem ) )
+    {
+        gsl_Expects( lastElem - firstElem == static_cast< difference_type >( Extent ) );
+    }
+    template<
+        gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
+        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
+        gsl_ENABLE_IF_NTTP_(( MyExtent == dynamic_extent ))
+    >
+    gsl_api gsl_constexpr14 span( iterator firstElem, iterator lastElem )
+        : storage_( firstElem.current_, gsl_lite::narrow_cast< size_type >( lastElem - firstElem ) )
+    {
+        gsl_Expects( firstElem <= lastElem );
+    }
+# else // !( gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( DEFAULT_FUNCTION_TEMPLATE_ARG ) && ! gsl_BETWEEN( gsl_COMPILER_MSVC_VERSION, 1, 140 ) )
+    gsl_api gsl_constexpr14 span( pointer ptr, size_type count )
+        : storage_( ptr, count )
+    {
+        gsl_Expects( Extent == dynamic_extent || count == Extent );
+    }
+    gsl_api gsl_constexpr14 span( iterator it, size_type count )
+        : storage_( it.current_, count )
+    {
+        gsl_Expects( Extent == dynamic_extent || count == Extent );
+        gsl_Expects( it.end_ - it.current_ >= static_cast< difference_type >( count ) );
+    }
+    gsl_api gsl_constexpr14 span( pointer firstElem, pointer lastElem )
+        : storage_( firstElem, gsl_lite::narrow_cast< size_type >( lastElem - firstElem ) )
+    {
+        gsl_Expects( firstElem <= lastElem );
+        gsl_Expects( Extent == dynamic_extent || lastElem - firstElem == static_cast< difference_type >( Extent ) );
+    }
+    gsl_api gsl_constexpr14 span( iterator firstElem, iterator lastElem )
+        : storage_( firstElem.current_, gsl_lite::narrow_cast< size_type >( lastElem - firstElem ) )
+    {
+        gsl_Expects( firstElem <= lastElem );
+        gsl_Expects( Extent == dynamic_extent || lastElem - firstElem == static_cast< difference_type >( Extent ) );
+    }
+# endif // gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( DEFAULT_FUNCTION_TEMPLATE_ARG ) && ! gsl_BETWEEN( gsl_COMPILER_MSVC_VERSION, 1, 140 )
+
+    template<
+        class U, std::size_t N
+        gsl_ENABLE_IF_(( detail::is_allowed_extent_conversion< N, Extent >::value &&
+                         detail::is_allowed_element_type_conversion< U, element_type >::value ))
+    >
+    gsl_api gsl_constexpr span( U (&arr)[N] ) gsl_noexcept
+        : storage_( known_not_null( arr ), detail::extent_type< N >( ) )
+    {
+    }
+
+# if gsl_HAVE( ARRAY )
+    template<
+        class U, std::size_t N
+        gsl_ENABLE_IF_(( detail::is_allowed_extent_conversion< N, Extent >::value &&
+                         detail::is_allowed_element_type_conversion< U, element_type >::value ))
+    >
+    gsl_api gsl_constexpr span( std::array<U, N> & arr ) gsl_noexcept
+        : storage_( known_not_null( arr.data() ), detail::extent_type< N >( ) )
+    {
+    }
+    template<
+        class U, std::size_t N
+        gsl_ENABLE_IF_(( detail::is_allowed_extent_conversion< N, Extent >::value &&
+                         detail::is_allowed_element_type_conversion< U const , element_type >::value ))
+    >
+    gsl_api gsl_constexpr span( std::array<U, N> const & arr ) gsl_noexcept
+        : storage_( known_not_null( arr.data() ), detail::extent_type< N >( ) )
+    {
+    }
+# endif // gsl_HAVE( ARRAY )
+
+# if gsl_HAVE( CONSTRAINED_SPAN_CONTAINER_CTOR )
+#  if ! gsl_BETWEEN( gsl_COMPILER_MSVC_VERSION, 1, 140 )
+    template< class Container, gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
+        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
+        gsl_ENABLE_IF_NTTP_(( MyExtent != dynamic_extent &&
+                              detail::is_compatible_container< Container, element_type >::value ))
+    >
+    gsl_api gsl_constexpr gsl_explicit span( Container & cont ) gsl_noexcept
+        : storage_( std17::data( cont ), std17::size( cont ) )
+    {
+    }
+    template< class Container, gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
+        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
+        gsl_ENABLE_IF_NTTP_(( MyExtent == dynamic_extent &&
+                              detail::is_compatible_container< Container, element_type >::value ))
+    >
+    gsl_api gsl_constexpr span( Container & cont ) gsl_noexcept
+        : storage_( std17::data( cont ), std17::size( cont ) )
+    {
+    }
+
+    template< class Container, gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
+        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
+        gsl_ENABLE_IF_NTTP_(( MyExtent != dynamic_extent &&
+                              std::is_const< element_type >::value &&
+                              detail::is_compatible_container< Container, element_type >::value ))
+    >
+    gsl_api gsl_constexpr gsl_explicit span( Container const & cont ) gsl_noexcept
+        : storage_( std17::data( cont ), std17::size( cont ) )
+    {
+    }
+    template< class Container, gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
+        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
+        gsl_ENABLE_IF_NTTP_(( MyExtent == dynamic_extent &&
+                              std::is_const< element_type >::value &&
+                              detail::is_compatible_container< Container, element_type >::value ))
+    >
+    gsl_api gsl_constexpr span( Container const & cont ) gsl_noexcept
+        : storage_( std17::data( cont ), std17::size( cont ) )
+    {
+    }
+#  else // gsl_BETWEEN( gsl_COMPILER_MSVC_VERSION, 1, 140 )
+    template< class Container
+        gsl_ENABLE_IF_(( detail::is_compatible_container< Container, element_type >::value ))
+    >
+    gsl_api gsl_constexpr span( Container & cont ) gsl_noexcept
+        : storage_( std17::data( cont ), std17::size( cont ) )
+    {
+    }
+    template< class Container, gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
+        gsl_ENABLE_IF_(( std::is_const< element_type >::value &&
+                         detail::is_compatible_container< Container, element_type >::value ))
+    >
+    gsl_api gsl_constexpr span( Container const & cont ) gsl_noexcept
+        : storage_( std17::data( cont ), std17::size( cont ) )
+    {
+    }
+#  endif // ! gsl_BETWEEN( gsl_COMPILER_MSVC_VERSION, 1, 140 )
+# elif gsl_HAVE( UNCONSTRAINED_SPAN_CONTAINER_CTOR )
+    template< class Container >
+    gsl_constexpr span( Container & cont )
+        : storage_( cont.size() == 0 ? gsl_nullptr : gsl_ADDRESSOF( cont[0] ), cont.size() )
+    {
+    }
+    template< class Container >
+    gsl_constexpr span( Container const & cont )
+        : storage_( cont.size() == 0 ? gsl_nullptr : gsl_ADDRESSOF( cont[0] ), cont.size() )
+    {
+    }
+# endif
+
+# if gsl_FEATURE_TO_STD( WITH_CONTAINER )
+    template< class Container >
+    gsl_constexpr span( with_container_t, Container & cont )
+        : storage_( cont.size() == 0 ? gsl_nullptr : gsl_ADDRESSOF( cont[0] ), cont.size() )
+    {
+    }
+    template< class Container >
+    gsl_constexpr span( with_container_t, Container const & cont )
+        : storage_( cont.size() == 0 ? gsl_nullptr : gsl_ADDRESSOF( cont[0] ), cont.size() )
+    {
+    }
+# endif
+
+# if gsl_HAVE( IS_DEFAULT ) && ! gsl_BETWEEN( gsl_COMPILER_GNUC_VERSION, 430, 600)
+    gsl_constexpr span( span && ) gsl_noexcept = default;
+    gsl_constexpr span( span const & ) = default;
+# else
+    gsl_api gsl_constexpr span( span const & other )
+        : storage_( other.storage_ )
+    {
+    }
+# endif
+
+# if gsl_HAVE( IS_DEFAULT )
+    gsl_constexpr14 span & operator=( span && ) gsl_noexcept = default;
+    gsl_constexpr14 span & operator=( span const & ) gsl_noexcept = default;
+# else
+    gsl_constexpr14 span & operator=( span const & other ) gsl_noexcept
+    {
+        storage_ = other.storage_;
+        return *this;
+    }
+# endif
+
+# if gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( DEFAULT_FUNCTION_TEMPLATE_ARG ) && ! gsl_BETWEEN( gsl_COMPILER_MSVC_VERSION, 1, 140 )
+    template<
+        class OtherElementType, gsl_CONFIG_SPAN_INDEX_TYPE OtherExtent, gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
+        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
+        gsl_ENABLE_IF_NTTP_(( ( MyExtent == dynamic_extent || MyExtent == OtherExtent ) &&
+                              detail::is_allowed_element_type_conversion< OtherElementType, element_type >::value ))
+    >
+    gsl_api gsl_constexpr span( span< OtherElementType, OtherExtent > const & other ) gsl_noexcept
+        : storage_( other.data(), detail::extent_type< OtherExtent >( other.size() ) )
+    {
+    }
+    template<
+        class OtherElementType, gsl_CONFIG_SPAN_INDEX_TYPE OtherExtent, gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
+        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
+        gsl_ENABLE_IF_NTTP_(( MyExtent != dynamic_extent && OtherExtent == dynamic_extent &&
+                              detail::is_allowed_element_type_conversion< OtherElementType, element_type >::value ))
+    >
+    gsl_api gsl_constexpr gsl_explicit span( span< OtherElementType, OtherExtent > const & other ) gsl_noexcept
+        : storage_( other.data(), detail::extent_type< OtherExtent >( other.size() ) )
+    {
+    }
+# else // !( gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( DEFAULT_FUNCTION_TEMPLATE_ARG ) && ! gsl_BETWEEN( gsl_COMPILER_MSVC_VERSION, 1, 140 ) )
+    template< class OtherElementType, gsl_CONFIG_SPAN_INDEX_TYPE OtherExtent >
+    gsl_api gsl_constexpr14 span( span< OtherElementType, OtherExtent > const & other )
+        : storage_( other.data(), detail::extent_type< OtherExtent >( other.size() ) )
+    {
+        gsl_STATIC_ASSERT_(
+            Extent == dynamic_extent || OtherExtent == dynamic_extent || Extent == OtherExtent,
+            "attempting copy-construction from incompatible span" );
+        gsl_Expects( Extent == dynamic_extent || other.size() == Extent );
+    }
+# endif // gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( DEFAULT_FUNCTION_TEMPLATE_ARG ) && ! gsl_BETWEEN( gsl_COMPILER_MSVC_VERSION, 1, 140 )
+
+    // [span.sub], span subviews
+
+    template< gsl_CONFIG_SPAN_INDEX_TYPE Count >
+    gsl_NODISCARD gsl_api gsl_constexpr14 span< element_type, Count >
+    first() const
+    {
+        gsl_STATIC_ASSERT_(
+            Extent == dynamic_extent || Count <= Extent,
+            "first() cannot extract more elements from a span than it contains" );
+        gsl_Expects( static_cast<std::size_t>( Count ) <= static_cast<std::size_t>( size() ) );
+        return span< element_type, Count >( data(), Count );
+    }
+
+    template< gsl_CONFIG_SPAN_INDEX_TYPE Count >
+    gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
+    gsl_NODISCARD gsl_api gsl_constexpr14 span< element_type, Count >
+    last() const
+    {
+        gsl_STATIC_ASSERT_(
+            Extent == dynamic_extent || Count <= Extent,
+            "last() cannot extract more elements from a span than it contains" );
+        gsl_Expects( static_cast<std::size_t>( Count ) <= static_cast<std::size_t>( size() ) );
+        return span< element_type, Count >( data() + ( size() - Count ), Count );
+    }
+
+    template< gsl_CONFIG_SPAN_INDEX_TYPE Offset, gsl_CONFIG_SPAN_INDEX_TYPE Count >
+    gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
+    gsl_NODISCARD gsl_api gsl_constexpr14 typename detail::calculate_subspan_type< T, Extent, Offset, Count >::type
+    subspan() const
+    {
+        gsl_STATIC_ASSERT_(
+            Extent == dynamic_extent || ( Extent >= Offset && ( Count == dynamic_extent ||
+                                                                Count <= Extent - Offset ) ),
+            "subspan() cannot extract more elements from a span than it contains.");
+        gsl_Expects( static_cast<std::size_t>( size() ) >= static_cast<std::size_t>( Offset ) &&
+                     ( Count == dynamic_extent || static_cast<std::size_t>( Count ) <= static_cast<std::size_t>( size() ) - static_cast<std::size_t>( Offset ) ) );
+        typedef typename detail::calculate_subspan_type< T, Extent, Offset, Count >::type type;
+        return type( data() + Offset, Count == dynamic_extent ? size() - Offset : Count );
+    }
+    template< gsl_CONFIG_SPAN_INDEX_TYPE Offset >
+    gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
+    gsl_NODISCARD gsl_api gsl_constexpr14 typename detail::calculate_subspan_type< T, Extent, Offset, dynamic_extent >::type
+    subspan() const
+    {
+        gsl_STATIC_ASSERT_(
+            Extent == dynamic_extent || Extent >= Offset,
+            "subspan() cannot extract more elements from a span than it contains.");
+        gsl_Expects( static_cast<std::size_t>( size() ) >= static_cast<std::size_t>( Offset ) );
+        typedef typename detail::calculate_subspan_type< T, Extent, Offset, dynamic_extent >::type type;
+        return type( data() + Offset, size() - Offset );
+    }
+
+    gsl_NODISCARD gsl_api gsl_constexpr14 span< element_type, dynamic_extent >
+    first( size_type count ) const
+    {
+        gsl_Expects( static_cast<std::size_t>( count ) <= static_cast<std::size_t>( size() ) );
+        return span< element_type, dynamic_extent >( data(), count );
+    }
+    gsl_NODISCARD gsl_api gsl_constexpr14 span< element_type, dynamic_extent >
+    last( size_type count ) const
+    {
+        gsl_Expects( static_cast<std::size_t>( count ) <= static_cast<std::size_t>( size() ) );
+        return make_subspan( size() - count, dynamic_extent, subspan_selector< Extent >() );
+    }
+
+    gsl_NODISCARD gsl_api gsl_constexpr14 span<element_type, dynamic_extent>
+    subspan(size_type offset, size_type count = dynamic_extent) const
+    {
+        return make_subspan(offset, count, subspan_selector< Extent >() );
+    }
+
+    // [span.obs], span observers
+
+    gsl_NODISCARD gsl_api gsl_constexpr size_type
+    size() const gsl_noexcept
+    {
+        return storage_.size();
+    }
+    gsl_NODISCARD gsl_api gsl_constexpr std::ptrdiff_t
+    ssize() const gsl_noexcept
+    {
+        return gsl_lite::narrow_cast< std::ptrdiff_t >( storage_.size() );
+    }
+
+    gsl_NODISCARD gsl_api gsl_constexpr size_type
+    size_bytes() const gsl_noexcept
+    {
+        return size() * sizeof(element_type);
+    }
+
+    gsl_NODISCARD gsl_api gsl_constexpr bool
+    empty() const gsl_noexcept
+    {
+        return size() == 0;
+    }
+
+    // [span.elem], span element access
+
+    gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
+    gsl_NODISCARD gsl_api gsl_constexpr14 reference
+    operator[](size_type idx) const
+    {
+        gsl_Expects( static_cast<std::size_t>( idx ) < static_cast<std::size_t>( size() ) );
+        return storage_.data()[ idx ];
+    }
+
+    gsl_NODISCARD gsl_api gsl_constexpr14
+    reference front() const
+    {
+        gsl_Expects( size() > 0 );
+        return storage_.data()[ 0 ];
+    }
+
+    gsl_NODISCARD gsl_api gsl_constexpr14
+    reference back() const
+    {
+        gsl_Expects( size() > 0 );
+        return storage_.data()[ size() - 1 ];
+    }
+
+    gsl_NODISCARD gsl_api gsl_constexpr pointer
+    data() const gsl_noexcept
+    {
+        return storage_.data();
+    }
+
+    // [span.iter], span iterator support
+
+    gsl_NODISCARD gsl_api gsl_constexpr14 iterator
+    begin() const gsl_noexcept
+    {
+        const pointer data = storage_.data();
+        gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
+        return iterator( data, data + size(), data );
+    }
+    gsl_NODISCARD gsl_api gsl_constexpr14 iterator
+    end() const gsl_noexcept
+    {
+        const pointer data = storage_.data();
+        gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
+        const pointer endData = data + storage_.size();
+        return iterator( data, endData, endData );
+    }
+    gsl_NODISCARD gsl_api gsl_constexpr14 const_iterator
+    cbegin() const gsl_noexcept
+    {
+        const pointer data = storage_.data();
+        gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
+        return const_iterator( data, data + size(), data );
+    }
+    gsl_NODISCARD gsl_api gsl_constexpr14 const_iterator
+    cend() const gsl_noexcept
+    {
+        const pointer data = storage_.data();
+        gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
+        const pointer endData = data + storage_.size();
+        return const_iterator( data, endData, endData );
+    }
+
+    gsl_NODISCARD gsl_api gsl_constexpr14 reverse_iterator
+    rbegin() const gsl_noexcept
+    {
+        return reverse_iterator( end() );
+    }
+    gsl_NODISCARD gsl_api gsl_constexpr14 reverse_iterator
+    rend() const gsl_noexcept
+    {
+        return reverse_iterator( begin() );
+    }
+
+    gsl_NODISCARD gsl_api gsl_constexpr14 const_reverse_iterator
+    crbegin() const gsl_noexcept
+    {
+        return const_reverse_iterator( cend() );
+    }
+    gsl_NODISCARD gsl_api gsl_constexpr14 const_reverse_iterator
+    crend() const gsl_noexcept
+    {
+        return const_reverse_iterator( cbegin() );
+    }
+
+    gsl_constexpr14 void
+    swap( span & other ) gsl_noexcept
+    {
+        std::swap( storage_, other.storage_ );
+    }
+
+# if ! gsl_DEPRECATE_TO_LEVEL( 9 )
+    template< class U >
+    gsl_DEPRECATED_MSG("as_span() member function is unsafe")
+    gsl_NODISCARD gsl_api typename detail::calculate_recast_span_type< element_type, U, Extent >::type
+    as_span() const
+    {
+        gsl_Expects( ( this->size_bytes() % sizeof( U ) ) == 0 );
+        typedef typename detail::calculate_recast_span_type< element_type, U, Extent >::type type;
+        return type( reinterpret_cast<U *>( data() ), size_bytes() / sizeof( U ) ); // NOLINT
+    }
+# endif // ! gsl_DEPRECATE_TO_LEVEL( 9 )
+
+# ifdef gsl_COMPILER_MS_STL_VERSION
+    // Tell MSVC how to unwrap spans in range-based-for
+    gsl_api gsl_constexpr pointer _Unchecked_begin() const gsl_noexcept { return data(); }
+    gsl_api gsl_constexpr pointer _Unchecked_end() const gsl_noexcept
+    {
+        gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
+        return data() + size();
+    }
+# endif // gsl_COMPILER_MS_STL_VERSION
+
+private:
+    // Needed to remove unnecessary null check in subspans
+    struct known_not_null
+    {
+        pointer p;
+
+        gsl_api gsl_constexpr known_not_null(pointer _p) gsl_noexcept
+            : p( _p )
+        {
+        }
+    };
+
+    // this implementation detail class lets us take advantage of the
+    // empty base class optimization to pay for only storage of a single
+    // pointer in the case of fixed-size spans
+    template< class ExtentType >
+    class storage_type : public ExtentType
+    {
+    public:
+        gsl_api gsl_constexpr storage_type( detail::extent_type< 0 > ext )
+            : ExtentType( ext ), data_( gsl_nullptr )
+        {
+        }
+
+        // known_not_null parameter is needed to remove unnecessary null check
+        // in subspans and constructors from arrays
+        template< class OtherExtentType >
+        gsl_api gsl_constexpr storage_type( known_not_null data, OtherExtentType ext )
+            : ExtentType( ext ), data_( data.p )
+        {
+        }
+
+        template< class OtherExtentType >
+        gsl_api gsl_constexpr14 storage_type( pointer data, OtherExtentType ext )
+            : ExtentType( ext ), data_( data )
+        {
+            gsl_Expects( data || ExtentType::size() == 0 );
+        }
+
+        gsl_api gsl_constexpr pointer data() const gsl_noexcept { return data_; }
+
+    private:
+        pointer data_;
+    };
+
+    storage_type< detail::extent_type< Extent > > storage_;
+
+    // The rest is needed to remove unnecessary null check
+    // in subspans and constructors from arrays
+    gsl_api gsl_constexpr span( known_not_null ptr, size_type count ) gsl_noexcept
+        : storage_(ptr, count)
+    {
+    }
+
+    template< gsl_CONFIG_SPAN_INDEX_TYPE CallerExtent >
+    class subspan_selector
+    {
+    };
+
+    template< gsl_CONFIG_SPAN_INDEX_TYPE CallerExtent >
+    gsl_api gsl_constexpr14 span< element_type, dynamic_extent >
+    make_subspan( size_type offset, size_type count, subspan_selector< CallerExtent > ) const
+    {
+        span< element_type, dynamic_extent > const tmp( *this );
+        return tmp.subspan( offset, count );
+    }
+
+    gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
+    gsl_api gsl_constexpr14 span< element_type, dynamic_extent >
+    make_subspan( size_type offset, size_type count, subspan_selector< dynamic_extent > ) const
+    {
+        gsl_Expects( static_cast<std::size_t>( size() ) >= static_cast<std::size_t>( offset ) );
+
+        if ( count == dynamic_extent )
+        {
+            return span< element_type, dynamic_extent >( known_not_null( data() + offset ), size() - offset );
+        }
+
+        gsl_Expects( static_cast<std::size_t>( size() ) - static_cast<std::size_t>( offset ) >= static_cast<std::size_t>( count ) );
+        return span< element_type, dynamic_extent >( known_not_null( data() + offset ), count );
+    }
+};
+
+// class template argument deduction guides:
+
+# if gsl_HAVE( DEDUCTION_GUIDES )   // gsl_CPP17_OR_GREATER
+
+template<class Type, std::size_t Extent >
+span( Type (&)[Extent] ) -> span< Type, Extent >;
+
+template< class Type, std::size_t Size >
+span( std::array<Type, Size> & ) -> span< Type, Size >;
+
+template< class Type, std::size_t Size >
+span( std::array<Type, Size> const & ) -> span< Type const, Size >;
+
+template< class Container,
+          class Element = std::remove_pointer_t<decltype( std::declval< Container & >().data()) > >
+span( Container & ) -> span< Element >;
+
+template< class Container,
+          class Element = std::remove_pointer_t<decltype( std::declval< Container const & >().data()) > >
+span( Container const & ) -> span< Element >;
+
+# endif // gsl_HAVE( DEDUCTION_GUIDES )
+
+# if ! gsl_CPP17_OR_GREATER
+#  if defined( __clang__ ) && defined( _MSC_VER )
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wdeprecated" // Bug in clang-cl.exe which raises a C++17 -Wdeprecated warning about this static constexpr workaround in C++14 mode.
+#  endif // defined( __clang__ ) && defined( _MSC_VER )
+template< class T, gsl_CONFIG_SPAN_INDEX_TYPE Extent >
+gsl_constexpr const typename span< T, Extent >::size_type span< T, Extent >::extent;
+#  if defined( __clang__ ) && defined( _MSC_VER )
+#   pragma clang diagnostic pop
+#  endif // defined( __clang__ ) && defined( _MSC_VER )
+# endif // ! gsl_CPP17_OR_GREATER
+
+# if gsl_COMPILER_MSVC_VER
+#  pragma warning( pop )
+# endif // gsl_COMPILER_MSVC_VER
+
+# if defined( __GNUC__ ) && __GNUC__ > 6
+#  pragma GCC diagnostic pop
+# endif // defined( __GNUC__ ) && __GNUC__ > 6
+
+# if defined( __clang__ )
+#  if __has_warning( "-Wunsafe-buffer-usage" )
+#   pragma clang diagnostic pop
+#  endif // __has_warning( "-Wunsafe-buffer-usage" )
+# endif // defined( __clang__ )
+
+// 26.7.3.7 Comparison operators [span.comparison]
+
+# if gsl_CONFIG( ALLOWS_SPAN_COMPARISON )
+#  if gsl_CONFIG( ALLOWS_NONSTRICT_SPAN_COMPARISON )
+
+template< class T, class U, gsl_CONFIG_SPAN_INDEX_TYPE LExtent, gsl_CONFIG_SPAN_INDEX_TYPE RExtent >
+gsl_SUPPRESS_MSGSL_WARNING(stl.1)
+gsl_NODISCARD inline gsl_constexpr bool operator==( span<T, LExtent> const & l, span<U, RExtent> const & r )
+{
+    gsl_STATIC_ASSERT_( LExtent == RExtent || LExtent == dynamic_extent || RExtent == dynamic_extent, "comparing spans of mismatching sizes" );
+    return  l.size()  == r.size()
+        && ( l.data() == r.data() || detail::equal( l.begin(), l.end(), r.begin() ) );
+}
+
+template< class T, class U, gsl_CONFIG_SPAN_INDEX_TYPE LExtent, gsl_CONFIG_SPAN_INDEX_TYPE RExtent >
+gsl_SUPPRESS_MSGSL_WARNING(stl.1)
+gsl_NODISCARD inline gsl_constexpr bool operator< ( span<T, LExtent> const & l, span<U, RExtent> const & r )
+{
+    return detail::lexicographical_compare( l.begin(), l.end(), r.begin(), r.end() );
+}
+
+#  else // a.k.a. !gsl_CONFIG( ALLOWS_NONSTRICT_SPAN_COMPARISON )
+
+template< class T, gsl_CONFIG_SPAN_INDEX_TYPE LExtent, gsl_CONFIG_SPAN_INDEX_TYPE RExtent >
+gsl_SUPPRESS_MSGSL_WARNING(stl.1)
+gsl_NODISCARD inline gsl_constexpr bool operator==( span<T, LExtent> const & l, span<T, RExtent> const & r )
+{
+    gsl_STATIC_ASSERT_( LExtent == RExtent || LExtent == dynamic_extent || RExtent == dynamic_extent, "comparing spans of mismatching sizes" );
+    return  l.size()  == r.size()
+        && ( l.data() == r.data() || detail::equal( l.begin(), l.end(), r.begin() ) );
+}
+
+template< class T, gsl_CONFIG_SPAN_INDEX_TYPE LExtent, gsl_CONFIG_SPAN_INDEX_TYPE RExtent >
+gsl_SUPPRESS_MSGSL_WARNING(stl.1)
+gsl_NODISCARD inline gsl_constexpr bool operator< ( span<T, LExtent> const & l, span<T, RExtent> const & r )
+{
+    return detail::lexicographical_compare( l.begin(), l.end(), r.begin(), r.end() );
+}
+#  endif // gsl_CONFIG( ALLOWS_NONSTRICT_SPAN_COMPARISON )
+
+template< class T, class U, gsl_CONFIG_SPAN_INDEX_TYPE LExtent, gsl_CONFIG_SPAN_INDEX_TYPE RExtent >
+gsl_NODISCARD inline gsl_constexpr bool
+operator!=( span<T, LExtent> const & l, span<U, RExtent> const & r )
+{
+    return !( l == r );
+}
+
+template< class T, class U, gsl_CONFIG_SPAN_INDEX_TYPE LExtent, gsl_CONFIG_SPAN_INDEX_TYPE RExtent >
+gsl_NODISCARD inline gsl_constexpr bool
+operator<=( span<T, LExtent> const & l, span<U, RExtent> const & r )
+{
+    return !( r < l );
+}
+
+template< class T, class U, gsl_CONFIG_SPAN_INDEX_TYPE LExtent, gsl_CONFIG_SPAN_INDEX_TYPE RExtent >
+gsl_NODISCARD inline gsl_constexpr bool
+operator>( span<T, LExtent> const & l, span<U, RExtent> const & r )
+{
+    return ( r < l );
+}
+
+template< class T, class U, gsl_CONFIG_SPAN_INDEX_TYPE LExtent, gsl_CONFIG_SPAN_INDEX_TYPE RExtent >
+gsl_NODISCARD inline gsl_constexpr bool
+operator>=( span<T, LExtent> const & l, span<U, RExtent> const & r )
+{
+    return !( l < r );
+}
+# endif // gsl_CONFIG( ALLOWS_SPAN_COMPARISON )
+
+// span algorithms
+
+template< class T, gsl_CONFIG_SPAN_INDEX_TYPE Extent >
+gsl_NODISCARD gsl_api inline gsl_constexpr std::size_t
+size( span<T, Extent> const & spn )
+{
+    return static_cast<std::size_t>( spn.size() );
+}
+
+template< class T, gsl_CONFIG_SPAN_INDEX_TYPE Extent >
+gsl_NODISCARD gsl_api inline gsl_constexpr std::ptrdiff_t
+ssize( span<T, Extent> const & spn )
+{
+    return spn.ssize();
+}
+
+namespace detail {
+
+template< class II, class N, class OI >
+gsl_api gsl_constexpr14 inline OI copy_n( II first, N count, OI result )
+{
+    if ( count > 0 )
+    {
+        *result++ = *first;
+        for ( N i = 1; i < count; ++i )
+        {
+            *result++ = *++first;
+        }
+    }
+    return result;
+}
+
+} // namespace detail
+
+template< class T, class U, gsl_CONFIG_SPAN_INDEX_TYPE LExtent, gsl_CONFIG_SPAN_INDEX_TYPE RExtent >
+gsl_api gsl_constexpr14 inline void copy( span<T, LExtent> src, span<U, RExtent> dest )
+{
+# if gsl_CPP14_OR_GREATER // gsl_HAVE( TYPE_TRAITS ) (circumvent Travis clang 3.4)
+    static_assert( std::is_assignable<U &, T const &>::value, "Cannot assign elements of source span to elements of destination span" );
+# endif
+    gsl_STATIC_ASSERT_( RExtent >= LExtent || LExtent == dynamic_extent || RExtent == dynamic_extent ,"incompatible span extents" );
+    gsl_Expects( dest.size() >= src.size() );
+    detail::copy_n( src.data(), src.size(), dest.data() );
+}
+
+# if gsl_FEATURE( BYTE )
+// span creator functions (see ctors)
+
+template< class T, gsl_CONFIG_SPAN_INDEX_TYPE Extent >
+gsl_NODISCARD gsl_api inline span< const byte >
+as_bytes( span< T, Extent > spn ) gsl_noexcept
+{
+    return span< const byte >( reinterpret_cast<const byte *>( spn.data() ), spn.size_bytes() ); // NOLINT
+}
+
+template< class T, gsl_CONFIG_SPAN_INDEX_TYPE Extent >
+gsl_NODISCARD gsl_api inline span< byte >
+as_writable_bytes( span< T, Extent > spn ) gsl_noexcept
+{
+    return span< byte >( reinterpret_cast<byte *>( spn.data() ), spn.size_bytes() ); // NOLINT
+}
+# endif // gsl_FEATURE( BYTE )
+
+# if gsl_FEATURE_TO_STD( MAKE_SPAN )
+
+template< class T >
+gsl_NODISCARD gsl_api inline gsl_constexpr span<T>
+make_span( T * ptr, typename span<T>::index_type count )
+{
+    return span<T>( ptr, count );
+}
+
+template< class T >
+gsl_NODISCARD gsl_api inline gsl_constexpr span<T>
+make_span( T * first, T * last )
+{
+    return span<T>( first, last );
+}
+
+template< class T, std::size_t N >
+gsl_NODISCARD inline gsl_constexpr span<T, static_cast<gsl_CONFIG_SPAN_INDEX_TYPE>( N )>
+make_span( T (&arr)[N] )
+{
+    return span<T, static_cast<gsl_CONFIG_SPAN_INDEX_TYPE>( N )>( arr );
+}
+
+#  if gsl_HAVE( ARRAY )
+
+template< class T, std::size_t N >
+gsl_NODISCARD inline gsl_constexpr span<T, static_cast<gsl_CONFIG_SPAN_INDEX_TYPE>( N )>
+make_span( std::array<T, N> & arr )
+{
+    return span<T, static_cast<gsl_CONFIG_SPAN_INDEX_TYPE>( N )>( arr );
+}
+
+template< class T, std::size_t N >
+gsl_NODISCARD inline gsl_constexpr span<const T, static_cast<gsl_CONFIG_SPAN_INDEX_TYPE>( N )>
+make_span( std::array<T, N> const & arr )
+{
+    return span<const T, static_cast<gsl_CONFIG_SPAN_INDEX_TYPE>( N )>( arr );
+}
+#  endif
+
+# if gsl_HAVE( CONSTRAINED_SPAN_CONTAINER_CTOR ) && gsl_HAVE( AUTO )
+
+template< class Container, class EP = decltype( std17::data(std::declval<Container&>())) >
+gsl_NODISCARD inline gsl_constexpr auto
+make_span( Container & cont ) -> span< typename std::remove_pointer<EP>::type >
+{
+    return span< typename std::remove_pointer<EP>::type >( cont );
+}
+
+template< class Container, class EP = decltype( std17::data(std::declval<Container&>())) >
+gsl_NODISCARD inline gsl_constexpr auto
+make_span( Container const & cont ) -> span< const typename std::remove_pointer<EP>::type >
+{
+    return span< const typename std::remove_pointer<EP>::type >( cont );
+}
+
+#  else
+
+template< class T >
+inline span<T>
+make_span( std::vector<T> & cont )
+{
+    return span<T>( cont.data(), cont.data() + cont.size() );
+}
+
+template< class T >
+inline span<const T>
+make_span( std::vector<T> const & cont )
+{
+    return span<const T>( cont.data(), cont.data() + cont.size() );
+}
+
+#  endif
+
+#  if gsl_FEATURE_TO_STD( WITH_CONTAINER )
+
+template< class Container >
+gsl_NODISCARD inline gsl_constexpr span<typename Container::value_type>
+make_span( with_container_t, Container & cont ) gsl_noexcept
+{
+    return span< typename Container::value_type >( with_container, cont );
+}
+
+template< class Container >
+gsl_NODISCARD inline gsl_constexpr span<const typename Container::value_type>
+make_span( with_container_t, Container const & cont ) gsl_noexcept
+{
+    return span< const typename Container::value_type >( with_container, cont );
+}
+
+#  endif // gsl_FEATURE_TO_STD( WITH_CONTAINER )
+# endif // gsl_FEATURE_TO_STD( MAKE_SPAN )
+
+# if gsl_FEATURE( BYTE ) && gsl_FEATURE_TO_STD( BYTE_SPAN )
+
+template< class T >
+gsl_NODISCARD gsl_api inline gsl_constexpr span<byte>
+byte_span( T & t ) gsl_noexcept
+{
+    return span<byte>( reinterpret_cast<byte *>( &t ), sizeof(T) );
+}
+
+template< class T >
+gsl_NODISCARD gsl_api inline gsl_constexpr span<const byte>
+byte_span( T const & t ) gsl_noexcept
+{
+    return span<const byte>( reinterpret_cast<byte const *>( &t ), sizeof(T) );
+}
+
+# endif // gsl_FEATURE( BYTE ) && gsl_FEATURE_TO_STD( BYTE_SPAN )
+#endif // gsl_FEATURE( SPAN )
+
+//
+// not_null_span<> - View of a contiguous sequence of non-null pointers.
+//
+// All pointers are validated once when the view is constructed, and element access yields `not_null<T*>` without
+// further checks. Arrays of `not_null<T*>`, which are layout-compatible with arrays of `T*`, are viewed without validation.
+//
+
+namespace detail {
+
+template< class T >
+struct is_not_null_pointer_
+{
+    gsl_NODISCARD gsl_api gsl_constexpr bool
+    operator()( T * ptr ) const gsl_noexcept
+    {
+        return ptr != gsl_nullptr;
+    }
+};
+
+template< class T >
+gsl_NODISCARD gsl_api gsl_constexpr14 inline bool
+all_not_null_( T * const * first, T * const * last )
+{
+    is_not_null_pointer_< T > pred;
+    return all_of_( first, last, pred );
+}
+
+template< class T >
+class not_null_span_iterator
+{
+private:
+    T * const * current_;
+
+public:
+    typedef std::input_iterator_tag iterator_category;
+    typedef not_null< T * > value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef value_type reference;
+    typedef void pointer;
+
+    gsl_api gsl_constexpr explicit not_null_span_iterator( T * const * current ) gsl_noexcept
+    : current_( current )
+    {
+    }
+
+    gsl_NODISCARD gsl_api reference
+    operator*() const gsl_noexcept
+    {
+        return not_null_accessor< T * >::make_unchecked( *current_ );
+    }
+    gsl_api gsl_constexpr14 not_null_span_iterator &
+    operator++() gsl_noexcept
+    {
+        ++current_;
+        return *this;
+    }
+    gsl_api gsl_constexpr14 not_null_span_iterator
+    operator++( int ) gsl_noexcept
+    {
+        not_null_span_iterator result = *this;
+        ++current_;
+        return result;
+    }
+
+    gsl_NODISCARD friend gsl_api gsl_constexpr bool
+    operator==( not_null_span_iterator const & lhs, not_null_span_iterator const & rhs ) gsl_noexcept
+    {
+        return lhs.current_ == rhs.current_;
+    }
+    gsl_NODISCARD friend gsl_api gsl_constexpr bool
+    operator!=( not_null_span_iterator const & lhs, not_null_span_iterator const & rhs ) gsl_noexcept
+    {
+        return lhs.current_ != rhs.current_;
+    }
+};
+
+} // namespace detail
+
+template< class T >
+class not_null_span
+{
+public:
+    typedef not_null< T * > element_type;
+    typedef not_null< T * > value_type;
+    typedef gsl_CONFIG_SPAN_INDEX_TYPE size_type;
+    typedef detail::not_null_span_iterator< T > iterator;
+    typedef detail::not_null_span_iterator< T > const_iterator;
+
+private:
+    T * const * data_;
+    size_type size_;
+
+    gsl_api gsl_constexpr not_null_span( T * const * data, size_type size, detail::not_null_unchecked_tag ) gsl_noexcept
+    : data_( data ), size_( size )
+    {
+    }
+
+    static gsl_api T * const *
+    from_not_null( not_null< T * > const * data ) gsl_noexcept
+    {
+        gsl_STATIC_ASSERT_( sizeof( not_null< T * > ) == sizeof( T * ), "not_null<T*> must be layout-compatible with T*" );
+        return reinterpret_cast< T * const * >( data );
+    }
+
+public:
+    gsl_api gsl_constexpr not_null_span() gsl_noexcept
+    : data_( gsl_nullptr ), size_( 0 )
+    {
+    }
+
+    gsl_api gsl_constexpr14 not_null_span( T * const * data, size_type size )
+    : data_( data ), size_( size )
+    {
+            // Also rejects negative sizes if `gsl_CONFIG_SPAN_INDEX_TYPE` is signed.
+        gsl_Expects( static_cast<std::size_t>( size ) <= static_cast<std::size_t>( -1 ) / sizeof( T * ) );
+        gsl_Expects( data != gsl_nullptr || size == 0 );
+        gsl_Expects( detail::all_not_null_( data, data + size ) );
+    }
+    template< std::size_t N >
+    gsl_api gsl_constexpr14 not_null_span( T * const ( &arr )[ N ] )
+    : data_( &arr[ 0 ] ), size_( N )
+    {
+        gsl_Expects( detail::all_not_null_( &arr[ 0 ], &arr[ 0 ] + N ) );
+    }
+
+    // Construction from arrays of `not_null<T*>` requires no validation.
+    gsl_api not_null_span( not_null< T * > const * data, size_type size )
+    : data_( from_not_null( data ) ), size_( size )
+    {
+        gsl_Expects( static_cast<std::size_t>( size ) <= static_cast<std::size_t>( -1 ) / sizeof( T * ) );
+        gsl_Expects( data != gsl_nullptr || size == 0 );
+    }
+    template< std::size_t N >
+    gsl_api not_null_span( not_null< T * > const ( &arr )[ N ] ) gsl_noexcept
+    : data_( from_not_null( &arr[ 0 ] ) ), size_( N )
+    {
+    }
+
+#if gsl_FEATURE( SPAN )
+    gsl_api gsl_constexpr14 not_null_span( span< T * > s )
+    : data_( s.data() ), size_( s.size() )
+    {
+        gsl_Expects( detail::all_not_null_( s.data(), s.data() + s.size() ) );
+    }
+    gsl_api gsl_constexpr14 not_null_span( span< T * const > s )
+    : data_( s.data() ), size_( s.size() )
+    {
+        gsl_Expects( detail::all_not_null_( s.data(), s.data() + s.size() ) );
+    }
+    gsl_api not_null_span( span< not_null< T * > > s ) gsl_noexcept
+    : data_( from_not_null( s.data() ) ), size_( s.size() )
+    {
+    }
+    gsl_api not_null_span( span< not_null< T * > const > s ) gsl_noexcept
+    : data_( from_not_null( s.data() ) ), size_( s.size() )
+    {
+    }
+#endif // gsl_FEATURE( SPAN )
+
+    gsl_NODISCARD gsl_api gsl_constexpr size_type
+    size() const gsl_noexcept
+    {
+        return size_;
+    }
+    gsl_NODISCARD gsl_api gsl_constexpr bool
+    empty() const gsl_noexcept
+    {
+        return size_ == 0;
+    }
+    gsl_NODISCARD gsl_api gsl_constexpr T * const *
+    data() const gsl_noexcept
+    {
+        return data_;
+    }
+
+    gsl_NODISCARD gsl_api value_type
+    operator[]( size_type index ) const
+    {
+        gsl_Expects( static_cast<std::size_t>( index ) < static_cast<std::size_t>( size_ ) );
+        return detail::not_null_accessor< T * >::make_unchecked( data_[ index ] );
+    }
+
+    gsl_NODISCARD gsl_api gsl_constexpr14 not_null_span
+    first( size_type count ) const
+    {
+        gsl_Expects( static_cast<std::size_t>( count ) <= static_cast<std::size_t>( size_ ) );
+        return not_null_span( data_, count, detail::not_null_unchecked_tag() );
+    }
+    gsl_NODISCARD gsl_api gsl_constexpr14 not_null_span
+    last( size_type count ) const
+    {
+        gsl_Expects( static_cast<std::size_t>( count ) <= static_cast<std::size_t>( size_ ) );
+        return not_null_span( data_ + ( size_ - count ), count, detail::not_null_unchecked_tag() );
+    }
+    gsl_NODISCARD gsl_api gsl_constexpr14 not_null_span
+    subspan( size_type offset, size_type count ) const
+    {
+        gsl_Expects( static_cast<std::size_t>( offset ) <= static_cast<std::size_t>( size_ )
+                  && static_cast<std::size_t>( count ) <= static_cast<std::size_t>( size_ - offset ) );
+        return not_null_span( data_ + offset, count, detail::not_null_unchecked_tag() );
+    }
+
+    gsl_NODISCARD gsl_api gsl_constexpr iterator
+    begin() const gsl_noexcept
+    {
+        return iterator( data_ );
+    }
+    gsl_NODISCARD gsl_api gsl_constexpr iterator
+    end() const gsl_noexcept
+    {
+        return iterator( data_ + size_ );
+    }
+};
+
+#if gsl_FEATURE( EXPERIMENTAL_SLOT_MAP ) && gsl_STDLIB_CPP11_OR_GREATER
+
+//
+// slot_map<> - Densely stored objects addressed by stable, generation-checked keys.
+//
+// Objects are kept contiguous in insertion order modulo erasure; erasing moves the last object into the gap. Keys consist of
+// a 32-bit slot index and a 32-bit generation which is incremented whenever the slot is vacated, so keys of erased objects
+// can be detected. Generation 0 is never used, hence a value-initialized key never refers to an object.
+
+struct slot_map_key
+{
+    std::uint32_t index;
+    std::uint32_t generation;
+
+    gsl_NODISCARD friend gsl_api gsl_constexpr bool
+    operator==( slot_map_key const & lhs, slot_map_key const & rhs ) gsl_noexcept
+    {
+        return lhs.index == rhs.index && lhs.generation == rhs.generation;
+    }
+    gsl_NODISCARD friend gsl_api gsl_constexpr bool
+    operator!=( slot_map_key const & lhs, slot_map_key const & rhs ) gsl_noexcept
+    {
+        return !( lhs == rhs );
+    }
+};
+
+template< class T >
+class slot_map
+{
+public:
+    typedef T value_type;
+    typedef slot_map_key key_type;
+    typedef std::size_t size_type;
+    typedef T * iterator;
+    typedef T const * const_iterator;
+
+private:
+    struct slot
+    {
+        std::uint32_t position;  // index into `values_` if occupied, next free slot otherwise
+        std::uint32_t generation;
+    };
+
+    static const std::uint32_t npos = static_cast< std::uint32_t >( -1 );
+
+    std::vector< T > values_;
+    std::vector< std::uint32_t > value_slots_;  // slot index for every element of `values_`
+    std::vector< slot > slots_;
+    std::uint32_t free_head_;
+
+    gsl_NODISCARD bool
+    is_valid( key_type key ) const gsl_noexcept
+    {
+        return key.index < slots_.size() && slots_[ key.index ].generation == key.generation;
+    }
+
+    void
+    vacate( std::uint32_t index ) gsl_noexcept
+    {
+        slot & s = slots_[ index ];
+        s.generation = s.generation + 1 != 0 ? s.generation + 1 : 1;
+        s.position = free_head_;
+        free_head_ = index;
+    }
+
+    template< class... Args >
+    key_type
+    do_emplace( Args &&... args )
+    {
+        std::uint32_t index = free_head_;
+        if ( index == npos )
+        {
+            gsl_Expects( slots_.size() < npos );
+            slot s = { npos, 1 };
+            slots_.push_back( s );
+            index = static_cast< std::uint32_t >( slots_.size() - 1 );
+            free_head_ = index;
+        }
+        gsl_Expects( values_.size() < npos );
+
+        values_.emplace_back( std::forward<Args>( args )... );
+        struct pop_on_failure
+        {
+            std::vector< T > & values;
+            bool active;
+            ~pop_on_failure() { if ( active ) values.pop_back(); }
+        } guard = { values_, true };
+        value_slots_.push_back( index );
+        guard.active = false;
+
+        free_head_ = slots_[ index ].position;
+        slots_[ index ].position = static_cast< std::uint32_t >( values_.size() - 1 );
+        key_type result = { index, slots_[ index ].generation };
+        return result;
+    }
+
+public:
+    slot_map() gsl_noexcept
+    : free_head_( npos )
+    {
+    }
+
+    gsl_NODISCARD size_type
+    size() const gsl_noexcept
+    {
+        return values_.size();
+    }
+    gsl_NODISCARD bool
+    empty() const gsl_noexcept
+    {
+        return values_.empty();
+    }
+    void
+    reserve( size_type n )
+    {
+        values_.reserve( n );
+        value_slots_.reserve( n );
+        slots_.reserve( n );
+    }
+
+    key_type
+    insert( T const & value )
+    {
+        return do_emplace( value );
+    }
+    key_type
+    insert( T && value )
+    {
+        return do_emplace( std::move( value ) );
+    }
+    template< class... Args >
+    key_type
+    emplace( Args &&... args )
+    {
+        return do_emplace( std::forward<Args>( args )... );
+    }
+
+    // Erases the object referred to by `key` by moving the last object into its place.
+    void
+    erase( key_type key )
+    {
+        gsl_Expects( is_valid( key ) );
+
+        slot & s = slots_[ key.index ];
+        std::uint32_t const last = static_cast< std::uint32_t >( values_.size() - 1 );
+        if ( s.position != last )
+        {
+            values_[ s.position ] = std::move( values_.back() );
+            value_slots_[ s.position ] = value_slots_.back();
+            slots_[ value_slots_[ s.position ] ].position = s.position;
+        }
+        values_.pop_back();
+        value_slots_.pop_back();
+        vacate( key.index );
+    }
+    void
+    clear() gsl_noexcept
+    {
+        for ( std::size_t i = 0; i != value_slots_.size(); ++i )
+        {
+            vacate( value_slots_[ i ] );
+        }
+        values_.clear();
+        value_slots_.clear();
+    }
+
+    gsl_NODISCARD bool
+    contains( key_type key ) const gsl_noexcept
+    {
+        return is_valid( key );
+    }
+
+    // Precondition: `key` refers to an object in the map.
+    gsl_NODISCARD not_null< T * >
+    get( key_type key )
+    {
+        gsl_Expects( is_valid( key ) );
+        return detail::not_null_accessor< T * >::make_unchecked( &values_[ slots_[ key.index ].position ] );
+    }
+    gsl_NODISCARD not_null< T const * >
+    get( key_type key ) const
+    {
+        gsl_Expects( is_valid( key ) );
+        return detail::not_null_accessor< T const * >::make_unchecked( &values_[ slots_[ key.index ].position ] );
+    }
+    gsl_NODISCARD optional_not_null< T * >
+    find( key_type key ) gsl_noexcept
+    {
+        return is_valid( key ) ? optional_not_null< T * >( &values_[ slots_[ key.index ].position ] ) : optional_not_null< T * >();
+    }
+    gsl_NODISCARD optional_not_null< T const * >
+    find( key_type key ) const gsl_noexcept
+    {
+        return is_valid( key ) ? optional_not_null< T const * >( &values_[ slots_[ key.index ].position ] ) : optional_not_null< T const * >();
+    }
+
+    // Returns the key of the object at position `pos` of the dense storage.
+    gsl_NODISCARD key_type
+    key_at( size_type pos ) const
+    {
+        gsl_Expects( pos < values_.size() );
+        key_type result = { value_slots_[ pos ], slots_[ value_slots_[ pos ] ].generation };
+        return result;
+    }
+
+    gsl_NODISCARD T *
+    data() gsl_noexcept
+    {
+        return values_.data();
+    }
+    gsl_NODISCARD T const *
+    data() const gsl_noexcept
+    {
+        return values_.data();
+    }
+    gsl_NODISCARD iterator
+    begin() gsl_noexcept
+    {
+        return values_.data();
+    }
+    gsl_NODISCARD iterator
+    end() gsl_noexcept
+    {
+        return values_.data() + values_.size();
+    }
+    gsl_NODISCARD const_iterator
+    begin() const gsl_noexcept
+    {
+        return values_.data();
+    }
+    gsl_NODISCARD const_iterator
+    end() const gsl_noexcept
+    {
+        return values_.data() + values_.size();
+    }
+# if gsl_FEATURE( SPAN )
+    gsl_NODISCARD span< T >
+    values() gsl_noexcept
+    {
+        return span< T >( values_ );
+    }
+    gsl_NODISCARD span< T const >
+    values() const gsl_noexcept
+    {
+        return span< T const >( values_ );
+    }
+# endif // gsl_FEATURE( SPAN )
+};
+
+#endif // gsl_FEATURE( EXPERIMENTAL_SLOT_MAP ) && gsl_STDLIB_CPP11_OR_GREATER
+
+#if gsl_FEATURE( EXPERIMENTAL_ARENA ) && gsl_STDLIB_CPP11_OR_GREATER
+
+//
+// monotonic_arena - Bump allocator for short-lived objects and buffers.
+//
+// Memory is carved out of a chain of blocks and only released as a whole. `reset()` rewinds to the first block in O(1) and
+// keeps all blocks for reuse. Objects are never destroyed by the arena, so only trivially destructible types can be created.
+// If AddressSanitizer is enabled, memory which has not been handed out is poisoned.
+
+class monotonic_arena
+{
+private:
+    struct block_header
+    {
+        block_header * next;
+        std::size_t size;
+    };
+
+    char * initial_buffer_;
+    std::size_t initial_size_;
+    block_header * first_;
+    block_header * current_;  // `nullptr` if allocating from the initial buffer
+    char * cur_;
+    char * end_;
+    std::size_t next_block_size_;
+
+    static std::size_t
+    header_size() gsl_noexcept
+    {
+        return ( sizeof( block_header ) + alignof( std::max_align_t ) - 1 ) / alignof( std::max_align_t ) * alignof( std::max_align_t );
+    }
+    static char *
+    block_data( block_header * block ) gsl_noexcept
+    {
+        return reinterpret_cast< char * >( block ) + header_size();
+    }
+    static std::size_t
+    padding( char * p, std::size_t alignment ) gsl_noexcept
+    {
+        return static_cast< std::size_t >( 0 - reinterpret_cast< std::uintptr_t >( p ) ) & ( alignment - 1 );
+    }
+
+    void *
+    allocate_slow( std::size_t bytes, std::size_t alignment )
+    {
+        gsl_Expects( bytes <= static_cast< std::size_t >( -1 ) - alignment - header_size() );
+        std::size_t const needed = bytes + alignment - 1;
+
+        block_header * next = current_ != gsl_nullptr ? current_->next : first_;
+        if ( next == gsl_nullptr || next->size < needed )
+        {
+            std::size_t const size = needed > next_block_size_ ? needed : next_block_size_;
+            block_header * block = static_cast< block_header * >( ::operator new( header_size() + size ) );
+            block->next = next;
+            block->size = size;
+            ( current_ != gsl_nullptr ? current_->next : first_ ) = block;
+            gsl_POISON_MEMORY_REGION_( block_data( block ), size );
+            if ( next_block_size_ <= static_cast< std::size_t >( -1 ) / 4 )
+            {
+                next_block_size_ *= 2;
+            }
+            next = block;
+        }
+        current_ = next;
+        end_ = block_data( next ) + next->size;
+        char * p = block_data( next ) + padding( block_data( next ), alignment );
+        cur_ = p + bytes;
+        return p;
+    }
+
+public:
+    explicit monotonic_arena( std::size_t initial_block_size = 4096 ) gsl_noexcept
+    : initial_buffer_( gsl_nullptr ), initial_size_( 0 ), first_( gsl_nullptr ), current_( gsl_nullptr )
+    , cur_( gsl_nullptr ), end_( gsl_nullptr ), next_block_size_( initial_block_size != 0 ? initial_block_size : 1 )
+    {
+    }
+    // Allocates from the `size` bytes at `buffer` first, e.g. a buffer on the stack, which must outlive the arena.
+    monotonic_arena( void * buffer, std::size_t size, std::size_t next_block_size = 4096 ) gsl_noexcept
+    : initial_buffer_( static_cast< char * >( buffer ) ), initial_size_( size )
+    , first_( gsl_nullptr ), current_( gsl_nullptr )
+    , cur_( initial_buffer_ ), end_( initial_buffer_ + initial_size_ ), next_block_size_( next_block_size != 0 ? next_block_size : 1 )
+    {
+        gsl_POISON_MEMORY_REGION_( initial_buffer_, initial_size_ );
+    }
+    ~monotonic_arena()
+    {
+        release();
+        gsl_UNPOISON_MEMORY_REGION_( initial_buffer_, initial_size_ );
+    }
+
+    gsl_NODISCARD not_null< void * >
+    allocate( std::size_t bytes, std::size_t alignment = alignof( std::max_align_t ) )
+    {
+        gsl_Expects( alignment != 0 && ( alignment & ( alignment - 1 ) ) == 0 );
+
+        void * result;
+        std::size_t const pad = padding( cur_, alignment );
+        std::size_t const available = static_cast< std::size_t >( end_ - cur_ );
+        if ( cur_ != gsl_nullptr && pad <= available && bytes <= available - pad )
+        {
+            result = cur_ + pad;
+            cur_ += pad + bytes;
+        }
+        else
+        {
+            result = allocate_slow( bytes, alignment );
+        }
+        gsl_UNPOISON_MEMORY_REGION_( result, bytes );
+        return detail::not_null_accessor< void * >::make_unchecked( result );
+    }
+
+# if gsl_FEATURE( SPAN )
+    // Allocates `n` value-initialized objects of type `T` with at least the alignment of `T`.
+    template< class T >
+    gsl_NODISCARD span< T >
+    allocate_span( std::size_t n, std::size_t alignment = alignof( T ) )
+    {
+        static_assert( std::is_trivially_destructible< T >::value, "monotonic_arena never destroys objects; T must be trivially destructible" );
+        gsl_Expects( n <= static_cast< std::size_t >( -1 ) / sizeof( T ) );
+
+        T * p = static_cast< T * >( as_nullable( allocate( n * sizeof( T ), alignment > alignof( T ) ? alignment : alignof( T ) ) ) );
+        for ( std::size_t i = 0; i != n; ++i )
+        {
+            ::new( static_cast< void * >( p + i ) ) T();
+        }
+        return span< T >( p, n );
+    }
+# endif // gsl_FEATURE( SPAN )
+
+    template< class T, class... Args >
+    gsl_NODISCARD not_null< T * >
+    make( Args &&... args )
+    {
+        static_assert( std::is_trivially_destructible< T >::value, "monotonic_arena never destroys objects; T must be trivially destructible" );
+
+        void * p = as_nullable( allocate( sizeof( T ), alignof( T ) ) );
+        return detail::not_null_accessor< T * >::make_unchecked( ::new( p ) T( std::forward<Args>( args )... ) );
+    }
+
+    // Makes all memory available again without returning blocks to the system.
+    void
+    reset() gsl_noexcept
+    {
+# if defined( gsl_ADDRESS_SANITIZER_ )
+        gsl_POISON_MEMORY_REGION_( initial_buffer_, initial_size_ );
+        for ( block_header * block = first_; block != gsl_nullptr; block = block->next )
+        {
+            gsl_POISON_MEMORY_REGION_( block_data( block ), block->size );
+        }
+# endif // defined( gsl_ADDRESS_SANITIZER_ )
+        current_ = gsl_nullptr;
+        cur_ = initial_buffer_;
+        end_ = initial_buffer_ + initial_size_;
+    }
+
+    // Returns all blocks to the system.
+    void
+    release() gsl_noexcept
+    {
+        reset();
+        while ( first_ != gsl_nullptr )
+        {
+            block_header * next = first_->next;
+            gsl_UNPOISON_MEMORY_REGION_( block_data( first_ ), first_->size );
+            ::operator delete( first_ );
+            first_ = next;
+        }
+    }
+
+gsl_is_delete_access:
+    monotonic_arena( monotonic_arena const & ) gsl_is_delete;
+    monotonic_arena & operator=( monotonic_arena const & ) gsl_is_delete;
+};
+
+// Allocator which obtains memory from a `monotonic_arena`. Deallocation is a no-op.
+template< class T >
+class arena_allocator
+{
+private:
+    monotonic_arena * arena_;
+
+public:
+    typedef T value_type;
+
+    explicit arena_allocator( monotonic_arena & arena ) gsl_noexcept
+    : arena_( &arena )
+    {
+    }
+    template< class U >
+    arena_allocator( arena_allocator< U > const & other ) gsl_noexcept
+    : arena_( &other.arena() )
+    {
+    }
+
+    gsl_NODISCARD T *
+    allocate( std::size_t n )
+    {
+        gsl_Expects( n <= static_cast< std::size_t >( -1 ) / sizeof( T ) );
+        return static_cast< T * >( as_nullable( arena_->allocate( n * sizeof( T ), alignof( T ) ) ) );
+    }
+    void
+    deallocate( T *, std::size_t ) gsl_noexcept
+    {
+    }
+
+    gsl_NODISCARD monotonic_arena &
+    arena() const gsl_noexcept
+    {
+        return *arena_;
+    }
+};
+
+template< class T, class U >
+gsl_NODISCARD inline bool
+operator==( arena_allocator< T > const & lhs, arena_allocator< U > const & rhs ) gsl_noexcept
+{
+    return &lhs.arena() == &rhs.arena();
+}
+template< class T, class U >
+gsl_NODISCARD inline bool
+operator!=( arena_allocator< T > const & lhs, arena_allocator< U > const & rhs ) gsl_noexcept
+{
+    return !( lhs == rhs );
+}
+
+# if defined( __cpp_lib_memory_resource )
+// Adapter which makes a `monotonic_arena` usable with polymorphic allocators. Deallocation is a no-op.
+class arena_memory_resource : public std::pmr::memory_resource
+{
+private:
+    monotonic_arena & arena_;
+
+    void *
+    do_allocate( std::size_t bytes, std::size_t alignment ) override
+    {
+        return as_nullable( arena_.allocate( bytes, alignment ) );
+    }
+    void
+    do_deallocate( void *, std::size_t, std::size_t ) override
+    {
+    }
+    bool
+    do_is_equal( std::pmr::memory_resource const & other ) const noexcept override
+    {
+        return this == &other;
+    }
+
+public:
+    explicit arena_memory_resource( monotonic_arena & arena ) noexcept
+    : arena_( arena )
+    {
+    }
+
+    gsl_NODISCARD monotonic_arena &
+    arena() const noexcept
+    {
+        return arena_;
+    }
+};
+# endif // defined( __cpp_lib_memory_resource )
+
+#endif // gsl_FEATURE( EXPERIMENTAL_ARENA ) && gsl_STDLIB_CPP11_OR_GREATER
+
+#if gsl_FEATURE( EXPERIMENTAL_OBJECT_POOL ) && gsl_STDLIB_CPP11_OR_GREATER
+
+//
+// object_pool<> - Fixed-capacity pool of objects with a lock-free free list.
+//
+// All storage is allocated on construction. Free slots are kept in a Treiber stack whose head carries a modification tag to
+// avoid the ABA problem. Threads which allocate frequently can use a `thread_cache<>`, which keeps a magazine of free slots
+// and exchanges them with the pool in batches.
+
+template< class T >
+class object_pool
+{
+public:
+    typedef T value_type;
+    typedef std::size_t size_type;
+
+private:
+    typedef std::uint32_t index_type;
+
+    struct alignas( T ) slot
+    {
+        unsigned char bytes[ sizeof( T ) ];
+    };
+
+    static const index_type nil = static_cast< index_type >( -1 );
+
+    std::unique_ptr< slot[] > slots_;
+    std::unique_ptr< std::atomic< index_type >[] > next_;  // free list links, kept apart from the object storage
+    index_type capacity_;
+    std::atomic< std::uint64_t > head_;  // index of the first free slot in the low 32 bits, modification tag in the high 32 bits
+
+    static std::uint64_t
+    make_head( index_type index, std::uint64_t old_head ) gsl_noexcept
+    {
+        return ( ( ( old_head >> 32 ) + 1 ) << 32 ) | index;
+    }
+
+    // Pushes the chain `first`..`last`, which must already be linked through `next_`.
+    void
+    push_chain( index_type first, index_type last ) gsl_noexcept
+    {
+        std::uint64_t old_head = head_.load( std::memory_order_relaxed );
+        do
+        {
+            next_[ last ].store( static_cast< index_type >( old_head ), std::memory_order_relaxed );
+        }
+        while ( ! head_.compare_exchange_weak( old_head, make_head( first, old_head ), std::memory_order_release, std::memory_order_relaxed ) );
+    }
+    index_type
+    pop() gsl_noexcept
+    {
+        std::uint64_t old_head = head_.load( std::memory_order_acquire );
+        for ( ;; )
+        {
+            index_type const index = static_cast< index_type >( old_head );
+            if ( index == nil )
+            {
+                return nil;
+            }
+            index_type const next = next_[ index ].load( std::memory_order_relaxed );
+            if ( head_.compare_exchange_weak( old_head, make_head( next, old_head ), std::memory_order_acquire, std::memory_order_acquire ) )
+            {
+                return index;
+            }
+        }
+    }
+
+    template< class... Args >
+    not_null< owner< T * > >
+    construct( index_type index, Args &&... args )
+    {
+        struct push_on_failure
+        {
+            object_pool & pool;
+            index_type index;
+            bool active;
+            ~push_on_failure() { if ( active ) pool.push_chain( index, index ); }
+        } guard = { *this, index, true };
+        T * p = ::new( static_cast< void * >( &slots_[ index ] ) ) T( std::forward<Args>( args )... );
+        guard.active = false;
+        return detail::not_null_accessor< T * >::make_unchecked( p );
+    }
+    index_type
+    destroy( not_null< owner< T * > > p )
+    {
+        gsl_Expects( owns( as_nullable( p ) ) );
+        T * raw = as_nullable( p );
+        raw->~T();
+        return static_cast< index_type >( reinterpret_cast< slot * >( raw ) - slots_.get() );
+    }
+
+public:
+    explicit object_pool( size_type capacity )
+    : slots_(), next_(), capacity_( 0 ), head_( nil )
+    {
+        gsl_Expects( capacity < nil );
+        capacity_ = static_cast< index_type >( capacity );
+        slots_.reset( new slot[ capacity ] );
+        next_.reset( new std::atomic< index_type >[ capacity ] );
+        for ( index_type i = 0; i != capacity_; ++i )
+        {
+            next_[ i ].store( i + 1 != capacity_ ? i + 1 : nil, std::memory_order_relaxed );
+        }
+        head_.store( capacity_ != 0 ? 0 : nil, std::memory_order_relaxed );
+    }
+    // Objects which have not been returned to the pool are not destroyed.
+    ~object_pool() = default;
+
+    gsl_NODISCARD size_type
+    capacity() const gsl_noexcept
+    {
+        return capacity_;
+    }
+    gsl_NODISCARD bool
+    owns( T const * p ) const gsl_noexcept
+    {
+        std::uintptr_t const first = reinterpret_cast< std::uintptr_t >( slots_.get() );
+        std::uintptr_t const ip = reinterpret_cast< std::uintptr_t >( p );
+        return ip >= first && ip - first < capacity_ * sizeof( slot ) && ( ip - first ) % sizeof( slot ) == 0;
+    }
+
+    // Constructs an object in a free slot. Precondition: the pool is not exhausted.
+    template< class... Args >
+    gsl_NODISCARD not_null< owner< T * > >
+    allocate( Args &&... args )
+    {
+        index_type const index = pop();
+        gsl_Expects( index != nil );
+        return construct( index, std::forward<Args>( args )... );
+    }
+    // Constructs an object in a free slot, or returns an empty `optional_not_null<>` if the pool is exhausted.
+    template< class... Args >
+    gsl_NODISCARD optional_not_null< owner< T * > >
+    try_allocate( Args &&... args )
+    {
+        index_type const index = pop();
+        if ( index == nil )
+        {
+            return optional_not_null< owner< T * > >();
+        }
+        return construct( index, std::forward<Args>( args )... );
+    }
+    // Destroys an object and returns its slot to the pool. Precondition: `p` was allocated from this pool.
+    void
+    deallocate( not_null< owner< T * > > p )
+    {
+        index_type const index = destroy( p );
+        push_chain( index, index );
+    }
+
+    // Per-thread cache of free slots. A cache must only be used by one thread at a time, and it must not outlive the pool.
+    template< std::size_t MagazineSize = 32 >
+    class thread_cache
+    {
+        gsl_STATIC_ASSERT_( MagazineSize >= 2, "magazine must hold at least 2 slots" );
+
+    private:
+        object_pool & pool_;
+        index_type magazine_[ MagazineSize ];
+        std::size_t count_;
+
+        void
+        refill() gsl_noexcept
+        {
+            while ( count_ < MagazineSize / 2 )
+            {
+                index_type const index = pool_.pop();
+                if ( index == nil )
+                {
+                    break;
+                }
+                magazine_[ count_++ ] = index;
+            }
+        }
+        // Returns the `n` most recently cached slots to the pool as one chain.
+        void
+        drain( std::size_t n ) gsl_noexcept
+        {
+            if ( n == 0 )
+            {
+                return;
+            }
+            std::size_t const first = count_ - n;
+            for ( std::size_t i = first; i + 1 != count_; ++i )
+            {
+                pool_.next_[ magazine_[ i ] ].store( magazine_[ i + 1 ], std::memory_order_relaxed );
+            }
+            pool_.push_chain( magazine_[ first ], magazine_[ count_ - 1 ] );
+            count_ = first;
+        }
+
+    public:
+        explicit thread_cache( object_pool & pool ) gsl_noexcept
+        : pool_( pool ), count_( 0 )
+        {
+        }
+        ~thread_cache()
+        {
+            flush();
+        }
+
+        template< class... Args >
+        gsl_NODISCARD not_null< owner< T * > >
+        allocate( Args &&... args )
+        {
+            if ( count_ == 0 )
+            {
+                refill();
+                gsl_Expects( count_ != 0 );
+            }
+            return pool_.construct( magazine_[ --count_ ], std::forward<Args>( args )... );
+        }
+        void
+        deallocate( not_null< owner< T * > > p )
+        {
+            index_type const index = pool_.destroy( p );
+            if ( count_ == MagazineSize )
+            {
+                drain( MagazineSize / 2 );
+            }
+            magazine_[ count_++ ] = index;
+        }
+        // Returns all cached slots to the pool.
+        void
+        flush() gsl_noexcept
+        {
+            drain( count_ );
+        }
+
+    gsl_is_delete_access:
+        thread_cache( thread_cache const & ) gsl_is_delete;
+        thread_cache & operator=( thread_cache const & ) gsl_is_delete;
+    };
+
+gsl_is_delete_access:
+    object_pool( object_pool const & ) gsl_is_delete;
+    object_pool & operator=( object_pool const & ) gsl_is_delete;
+};
+
+#endif // gsl_FEATURE( EXPERIMENTAL_OBJECT_POOL ) && gsl_STDLIB_CPP11_OR_GREATER
+
+#if gsl_FEATURE( EXPERIMENTAL_INPLACE_VECTOR ) && gsl_STDLIB_CPP11_OR_GREATER
+
+//
+// inplace_vector<> - Resizable array with fixed capacity and inline storage.
+//
+// Elements are stored within the object itself, hence an `inplace_vector<>` never allocates; exceeding the capacity is a
+// precondition violation. If `T` is trivially copyable and trivially destructible, so is `inplace_vector< T, N >`.
+// An `inplace_vector<>` converts to `span<>` through the span container constructors.
+
+namespace detail {
+
+template< class T, std::size_t N >
+struct inplace_vector_storage_base
+{
+    alignas( T ) unsigned char bytes_[ ( N != 0 ? N : 1 ) * sizeof( T ) ];
+    std::size_t size_;
+
+    inplace_vector_storage_base() gsl_noexcept
+    : size_( 0 )
+    {
+    }
+
+    T *
+    elements() gsl_noexcept
+    {
+        return static_cast< T * >( static_cast< void * >( bytes_ ) );
+    }
+    T const *
+    elements() const gsl_noexcept
+    {
+        return static_cast< T const * >( static_cast< void const * >( bytes_ ) );
+    }
+
+    template< class... Args >
+    T &
+    emplace_back_unchecked( Args &&... args )
+    {
+        ::new( static_cast< void * >( elements() + size_ ) ) T( std::forward<Args>( args )... );
+        return elements()[ size_++ ];
+    }
+
+    // Destroys the elements at positions `n` and above.
+    void
+    shrink_to( std::size_t n ) gsl_noexcept
+    {
+        while ( size_ != n )
+        {
+            elements()[ --size_ ].~T();
+        }
+    }
+
+    // Appends copies of the elements in `[first, last)`. If an exception is thrown, the appended elements are destroyed again.
+    template< class It >
+    void
+    append( It first, It last )
+    {
+        struct shrink_on_failure
+        {
+            inplace_vector_storage_base * self;
+            std::size_t n;
+            ~shrink_on_failure() { if ( self ) self->shrink_to( n ); }
+        } guard = { this, size_ };
+        for ( ; first != last; ++first )
+        {
+            gsl_Expects( size_ < N );
+            emplace_back_unchecked( *first );
+        }
+        guard.self = gsl_nullptr;
+    }
+
+    // Assigns the `n` elements starting at `first`, reusing existing elements where possible.
+    template< class It >
+    void
+    assign_n( It first, std::size_t n )
+    {
+        std::size_t i = 0;
+        for ( ; i != n && i != size_; ++i, ++first )
+        {
+            elements()[ i ] = *first;
+        }
+        if ( n < size_ )
+        {
+            shrink_to( n );
+        }
+        for ( ; i != n; ++i, ++first )
+        {
+            emplace_back_unchecked( *first );
+        }
+    }
+};
+
+template< class T, std::size_t N, bool Trivial = std::is_trivially_copyable< T >::value && std::is_trivially_destructible< T >::value >
+struct inplace_vector_storage : inplace_vector_storage_base< T, N >
+{
+};
+
+template< class T, std::size_t N >
+struct inplace_vector_storage< T, N, false > : inplace_vector_storage_base< T, N >
+{
+    inplace_vector_storage() gsl_noexcept
+    {
+    }
+    inplace_vector_storage( inplace_vector_storage const & other )
+    {
+        this->append( other.elements(), other.elements() + other.size_ );
+    }
+    inplace_vector_storage( inplace_vector_storage && other ) gsl_noexcept_if( std::is_nothrow_move_constructible< T >::value )
+    {
+        this->append( std::make_move_iterator( other.elements() ), std::make_move_iterator( other.elements() + other.size_ ) );
+    }
+    inplace_vector_storage &
+    operator=( inplace_vector_storage const & other )
+    {
+        if ( this != &other )
+        {
+            this->assign_n( other.elements(), other.size_ );
+        }
+        return *this;
+    }
+    inplace_vector_storage &
+    operator=( inplace_vector_storage && other ) gsl_noexcept_if( std::is_nothrow_move_assignable< T >::value && std::is_nothrow_move_constructible< T >::value )
+    {
+        if ( this != &other )
+        {
+            this->assign_n( std::make_move_iterator( other.elements() ), other.size_ );
+        }
+        return *this;
+    }
+    ~inplace_vector_storage()
+    {
+        this->shrink_to( 0 );
+    }
+};
+
+} // namespace detail
+
+template< class T, std::size_t N >
+class inplace_vector : private detail::inplace_vector_storage< T, N >
+{
+public:
+    typedef T value_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef T & reference;
+    typedef T const & const_reference;
+    typedef T * pointer;
+    typedef T const * const_pointer;
+    typedef T * iterator;
+    typedef T const * const_iterator;
+
+    inplace_vector() gsl_noexcept
+    {
+    }
+    explicit inplace_vector( size_type n )
+    {
+        gsl_Expects( n <= N );
+        while ( this->size_ != n )
+        {
+            this->emplace_back_unchecked();
+        }
+    }
+    inplace_vector( size_type n, T const & value )
+    {
+        gsl_Expects( n <= N );
+        while ( this->size_ != n )
+        {
+            this->emplace_back_unchecked( value );
+        }
+    }
+    template< class InputIt
+        gsl_ENABLE_IF_(( ! std::is_integral< InputIt >::value ))
+    >
+    inplace_vector( InputIt first, InputIt last )
+    {
+        this->append( first, last );
+    }
+# if gsl_HAVE( INITIALIZER_LIST )
+    inplace_vector( std::initializer_list< T > values )
+    {
+        gsl_Expects( values.size() <= N );
+        this->append( values.begin(), values.end() );
+    }
+# endif // gsl_HAVE( INITIALIZER_LIST )
+# if gsl_FEATURE( SPAN )
+    // Copies the elements of `values`, which must not exceed the capacity. For spans of static extent, this is checked at compile time.
+    template< class U, gsl_CONFIG_SPAN_INDEX_TYPE Extent
+        gsl_ENABLE_IF_(( Extent == dynamic_extent || static_cast< std::size_t >( Extent ) <= N ))
+    >
+    explicit inplace_vector( span< U, Extent > values )
+    {
+        gsl_Expects( values.size() <= N );
+        this->append( values.begin(), values.end() );
+    }
+# endif // gsl_FEATURE( SPAN )
+
+    gsl_NODISCARD size_type
+    size() const gsl_noexcept
+    {
+        return this->size_;
+    }
+    gsl_NODISCARD static gsl_constexpr size_type
+    capacity() gsl_noexcept
+    {
+        return N;
+    }
+    gsl_NODISCARD static gsl_constexpr size_type
+    max_size() gsl_noexcept
+    {
+        return N;
+    }
+    gsl_NODISCARD bool
+    empty() const gsl_noexcept
+    {
+        return this->size_ == 0;
+    }
+    gsl_NODISCARD bool
+    full() const gsl_noexcept
+    {
+        return this->size_ == N;
+    }
+
+    gsl_NODISCARD T *
+    data() gsl_noexcept
+    {
+        return this->elements();
+    }
+    gsl_NODISCARD T const *
+    data() const gsl_noexcept
+    {
+        return this->elements();
+    }
+    gsl_NODISCARD iterator
+    begin() gsl_noexcept
+    {
+        return this->elements();
+    }
+    gsl_NODISCARD iterator
+    end() gsl_noexcept
+    {
+        return this->elements() + this->size_;
+    }
+    gsl_NODISCARD const_iterator
+    begin() const gsl_noexcept
+    {
+        return this->elements();
+    }
+    gsl_NODISCARD const_iterator
+    end() const gsl_noexcept
+    {
+        return this->elements() + this->size_;
+    }
+    gsl_NODISCARD const_iterator
+    cbegin() const gsl_noexcept
+    {
+        return this->elements();
+    }
+    gsl_NODISCARD const_iterator
+    cend() const gsl_noexcept
+    {
+        return this->elements() + this->size_;
+    }
+
+    gsl_NODISCARD reference
+    operator[]( size_type pos )
+    {
+        gsl_Expects( pos < this->size_ );
+        return this->elements()[ pos ];
+    }
+    gsl_NODISCARD const_reference
+    operator[]( size_type pos ) const
+    {
+        gsl_Expects( pos < this->size_ );
+        return this->elements()[ pos ];
+    }
+    gsl_NODISCARD reference
+    front()
+    {
+        gsl_Expects( this->size_ != 0 );
+        return this->elements()[ 0 ];
+    }
+    gsl_NODISCARD const_reference
+    front() const
+    {
+        gsl_Expects( this->size_ != 0 );
+        return this->elements()[ 0 ];
+    }
+    gsl_NODISCARD reference
+    back()
+    {
+        gsl_Expects( this->size_ != 0 );
+        return this->elements()[ this->size_ - 1 ];
+    }
+    gsl_NODISCARD const_reference
+    back() const
+    {
+        gsl_Expects( this->size_ != 0 );
+        return this->elements()[ this->size_ - 1 ];
+    }
+
+    // Precondition: `! full()`.
+    reference
+    push_back( T const & value )
+    {
+        gsl_Expects( this->size_ < N );
+        return this->emplace_back_unchecked( value );
+    }
+    reference
+    push_back( T && value )
+    {
+        gsl_Expects( this->size_ < N );
+        return this->emplace_back_unchecked( std::move( value ) );
+    }
+    template< class... Args >
+    reference
+    emplace_back( Args &&... args )
+    {
+        gsl_Expects( this->size_ < N );
+        return this->emplace_back_unchecked( std::forward<Args>( args )... );
+    }
+
+    // Returns an empty `optional_not_null<>` if the vector is full.
+    optional_not_null< T * >
+    try_push_back( T const & value )
+    {
+        return try_emplace_back( value );
+    }
+    optional_not_null< T * >
+    try_push_back( T && value )
+    {
+        return try_emplace_back( std::move( value ) );
+    }
+    template< class... Args >
+    optional_not_null< T * >
+    try_emplace_back( Args &&... args )
+    {
+        if ( this->size_ == N )
+        {
+            return optional_not_null< T * >();
+        }
+        return optional_not_null< T * >( gsl_ADDRESSOF( this->emplace_back_unchecked( std::forward<Args>( args )... ) ) );
+    }
+
+    void
+    pop_back()
+    {
+        gsl_Expects( this->size_ != 0 );
+        this->shrink_to( this->size_ - 1 );
+    }
+    void
+    clear() gsl_noexcept
+    {
+        this->shrink_to( 0 );
+    }
+    void
+    resize( size_type n )
+    {
+        gsl_Expects( n <= N );
+        if ( n < this->size_ )
+        {
+            this->shrink_to( n );
+        }
+        while ( this->size_ != n )
+        {
+            this->emplace_back_unchecked();
+        }
+    }
+    void
+    resize( size_type n, T const & value )
+    {
+        gsl_Expects( n <= N );
+        if ( n < this->size_ )
+        {
+            this->shrink_to( n );
+        }
+        while ( this->size_ != n )
+        {
+            this->emplace_back_unchecked( value );
+        }
+    }
+
+    // Erases the elements in `[first, last)`, shifting the subsequent elements down.
+    iterator
+    erase( const_iterator first, const_iterator last )
+    {
+        gsl_Expects( begin() <= first && first <= last && last <= end() );
+        iterator dst = begin() + ( first - begin() );
+        iterator src = begin() + ( last - begin() );
+        if ( dst != src )
+        {
+            iterator const result = dst;
+            for ( ; src != end(); ++dst, ++src )
+            {
+                *dst = std::move( *src );
+            }
+            this->shrink_to( static_cast< size_type >( dst - begin() ) );
+            return result;
+        }
+        return dst;
+    }
+    iterator
+    erase( const_iterator pos )
+    {
+        gsl_Expects( begin() <= pos && pos < end() );
+        return erase( pos, pos + 1 );
+    }
+
+    gsl_NODISCARD friend bool
+    operator==( inplace_vector const & lhs, inplace_vector const & rhs )
+    {
+        if ( lhs.size() != rhs.size() )
+        {
+            return false;
+        }
+        for ( size_type i = 0; i != lhs.size(); ++i )
+        {
+            if ( !( lhs.data()[ i ] == rhs.data()[ i ] ) )
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    gsl_NODISCARD friend bool
+    operator!=( inplace_vector const & lhs, inplace_vector const & rhs )
+    {
+        return !( lhs == rhs );
+    }
+};
+
+#endif // gsl_FEATURE( EXPERIMENTAL_INPLACE_VECTOR ) && gsl_STDLIB_CPP11_OR_GREATER
+
+#if gsl_FEATURE( EXPERIMENTAL_DYN_ARRAY ) && gsl_STDLIB_CPP11_OR_GREATER
+
+//
+// dyn_array<> - Heap-allocated array whose size is fixed on construction.
+//
+// A `dyn_array<>` cannot grow, so unlike `std::vector<>` it does not store a capacity; with a stateless allocator, it consists
+// of a pointer and a size. Constructing it with `default_init` default-initializes the elements, which leaves elements of
+// trivial type uninitialized.
+
+struct default_init_t { gsl_constexpr default_init_t( ) gsl_noexcept { } };
+const  gsl_constexpr   default_init_t default_init;
+
+template< class T, class Alloc = std::allocator< T > >
+class dyn_array
+{
+public:
+    typedef T value_type;
+    typedef Alloc allocator_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef T & reference;
+    typedef T const & const_reference;
+    typedef T * pointer;
+    typedef T const * const_pointer;
+    typedef T * iterator;
+    typedef T const * const_iterator;
+
+private:
+    typedef std::allocator_traits< Alloc > traits;
+
+    static_assert( std::is_same< typename Alloc::value_type, T >::value, "dyn_array<T, Alloc>: Alloc::value_type must be T" );
+    static_assert( std::is_same< typename traits::pointer, T * >::value, "dyn_array<T, Alloc>: fancy pointers are not supported" );
+
+    // The allocator is a base class to benefit from the empty base optimization.
+    struct impl : Alloc
+    {
+        T * data;
+        std::size_t size;
+
+        explicit impl( Alloc const & alloc ) gsl_noexcept
+        : Alloc( alloc ), data( gsl_nullptr ), size( 0 )
+        {
+        }
+    } impl_;
+
+    Alloc &
+    alloc() gsl_noexcept
+    {
+        return impl_;
+    }
+    Alloc const &
+    alloc() const gsl_noexcept
+    {
+        return impl_;
+    }
+
+    // Allocates `n` elements and constructs each of them with `construct( p )`.
+    template< class Construct >
+    void
+    create( std::size_t n, Construct construct )
+    {
+        if ( n == 0 )
+        {
+            return;
+        }
+        gsl_Expects( n <= traits::max_size( alloc() ) );
+        struct destroy_on_failure
+        {
+            Alloc & alloc;
+            T * data;
+            std::size_t n;
+            std::size_t constructed;
+            ~destroy_on_failure()
+            {
+                if ( data == gsl_nullptr )
+                {
+                    return;
+                }
+                while ( constructed != 0 )
+                {
+                    traits::destroy( alloc, data + --constructed );
+                }
+                traits::deallocate( alloc, data, n );
+            }
+        } guard = { alloc(), traits::allocate( alloc(), n ), n, 0 };
+        for ( ; guard.constructed != n; ++guard.constructed )
+        {
+            construct( guard.data + guard.constructed );
+        }
+        impl_.data = guard.data;
+        impl_.size = n;
+        guard.data = gsl_nullptr;
+    }
+    template< class It >
+    void
+    create_from( It first, std::size_t n )
+    {
+        create( n, [ this, &first ]( T * p ) { traits::construct( alloc(), p, *first ); ++first; } );
+    }
+
+    void
+    destroy() gsl_noexcept
+    {
+        if ( impl_.data == gsl_nullptr )
+        {
+            return;
+        }
+        for ( std::size_t i = impl_.size; i != 0; --i )
+        {
+            traits::destroy( alloc(), impl_.data + i - 1 );
+        }
+        traits::deallocate( alloc(), impl_.data, impl_.size );
+        impl_.data = gsl_nullptr;
+        impl_.size = 0;
+    }
+
+    void
+    assign_allocator( Alloc const &, std::false_type ) gsl_noexcept
+    {
+    }
+    void
+    assign_allocator( Alloc const & other, std::true_type ) gsl_noexcept
+    {
+        alloc() = other;
+    }
+    void
+    swap_allocator( Alloc &, std::false_type ) gsl_noexcept
+    {
+    }
+    void
+    swap_allocator( Alloc & other, std::true_type ) gsl_noexcept
+    {
+        using std::swap;
+        swap( alloc(), other );
+    }
+
+    // Releases the elements and takes over the elements of `other`, along with its allocator if `Propagate` is true.
+    template< class Propagate >
+    void
+    take( dyn_array & other, Propagate propagate ) gsl_noexcept
+    {
+        destroy();
+        assign_allocator( other.alloc(), propagate );
+        impl_.data = other.impl_.data;
+        impl_.size = other.impl_.size;
+        other.impl_.data = gsl_nullptr;
+        other.impl_.size = 0;
+    }
+
+public:
+    dyn_array() gsl_noexcept
+    : impl_( Alloc() )
+    {
+    }
+    explicit dyn_array( Alloc const & alloc ) gsl_noexcept
+    : impl_( alloc )
+    {
+    }
+
+    // Constructs `n` value-initialized elements.
+    explicit dyn_array( size_type n, Alloc const & alloc = Alloc() )
+    : impl_( alloc )
+    {
+        create( n, [ this ]( T * p ) { traits::construct( this->alloc(), p ); } );
+    }
+    // Constructs `n` default-initialized elements. Elements of trivial type are left uninitialized.
+    dyn_array( size_type n, default_init_t, Alloc const & alloc = Alloc() )
+    : impl_( alloc )
+    {
+        create( n, []( T * p ) { ::new( static_cast< void * >( p ) ) T; } );
+    }
+    dyn_array( size_type n, T const & value, Alloc const & alloc = Alloc() )
+    : impl_( alloc )
+    {
+        create( n, [ this, &value ]( T * p ) { traits::construct( this->alloc(), p, value ); } );
+    }
+    template< class ForwardIt
+        gsl_ENABLE_IF_(( ! std::is_integral< ForwardIt >::value ))
+    >
+    dyn_array( ForwardIt first, ForwardIt last, Alloc const & alloc = Alloc() )
+    : impl_( alloc )
+    {
+        create_from( first, static_cast< size_type >( std::distance( first, last ) ) );
+    }
+# if gsl_HAVE( INITIALIZER_LIST )
+    dyn_array( std::initializer_list< T > values, Alloc const & alloc = Alloc() )
+    : impl_( alloc )
+    {
+        create_from( values.begin(), values.size() );
+    }
+# endif // gsl_HAVE( INITIALIZER_LIST )
+
+    dyn_array( dyn_array const & other )
+    : impl_( traits::select_on_container_copy_construction( other.alloc() ) )
+    {
+        create_from( other.begin(), other.size() );
+    }
+    dyn_array( dyn_array && other ) gsl_noexcept
+    : impl_( other.alloc() )
+    {
+        take( other, std::false_type() );
+    }
+
+    dyn_array &
+    operator=( dyn_array const & other )
+    {
+        typedef typename traits::propagate_on_container_copy_assignment propagate;
+        if ( this != &other )
+        {
+            dyn_array tmp( other.begin(), other.end(), propagate::value ? other.alloc() : alloc() );
+            take( tmp, propagate() );
+        }
+        return *this;
+    }
+    dyn_array &
+    operator=( dyn_array && other ) gsl_noexcept_if( std::allocator_traits< Alloc >::propagate_on_container_move_assignment::value )
+    {
+        typedef typename traits::propagate_on_container_move_assignment propagate;
+        if ( this == &other )
+        {
+            return *this;
+        }
+        if ( propagate::value || alloc() == other.alloc() )
+        {
+            take( other, propagate() );
+        }
+        else
+        {
+            dyn_array tmp( std::make_move_iterator( other.begin() ), std::make_move_iterator( other.end() ), alloc() );
+            take( tmp, std::false_type() );
+        }
+        return *this;
+    }
+
+    ~dyn_array()
+    {
+        destroy();
+    }
+
+    // Precondition: the allocators are equal or propagate on swap.
+    void
+    swap( dyn_array & other )
+    {
+        typedef typename traits::propagate_on_container_swap propagate;
+        gsl_Expects( propagate::value || alloc() == other.alloc() );
+        swap_allocator( other.alloc(), propagate() );
+        std::swap( impl_.data, other.impl_.data );
+        std::swap( impl_.size, other.impl_.size );
+    }
+    friend void
+    swap( dyn_array & lhs, dyn_array & rhs )
+    {
+        lhs.swap( rhs );
+    }
+
+    gsl_NODISCARD allocator_type
+    get_allocator() const gsl_noexcept
+    {
+        return alloc();
+    }
+
+    gsl_NODISCARD size_type
+    size() const gsl_noexcept
+    {
+        return impl_.size;
+    }
+    gsl_NODISCARD bool
+    empty() const gsl_noexcept
+    {
+        return impl_.size == 0;
+    }
+
+    gsl_NODISCARD T *
+    data() gsl_noexcept
+    {
+        return impl_.data;
+    }
+    gsl_NODISCARD T const *
+    data() const gsl_noexcept
+    {
+        return impl_.data;
+    }
+    gsl_NODISCARD iterator
+    begin() gsl_noexcept
+    {
+        return impl_.data;
+    }
+    gsl_NODISCARD iterator
+    end() gsl_noexcept
+    {
+        return impl_.data + impl_.size;
+    }
+    gsl_NODISCARD const_iterator
+    begin() const gsl_noexcept
+    {
+        return impl_.data;
+    }
+    gsl_NODISCARD const_iterator
+    end() const gsl_noexcept
+    {
+        return impl_.data + impl_.size;
+    }
+    gsl_NODISCARD const_iterator
+    cbegin() const gsl_noexcept
+    {
+        return impl_.data;
+    }
+    gsl_NODISCARD const_iterator
+    cend() const gsl_noexcept
+    {
+        return impl_.data + impl_.size;
+    }
+
+    gsl_NODISCARD reference
+    operator[]( size_type pos )
+    {
+        gsl_Expects( pos < impl_.size );
+        return impl_.data[ pos ];
+    }
+    gsl_NODISCARD const_reference
+    operator[]( size_type pos ) const
+    {
+        gsl_Expects( pos < impl_.size );
+        return impl_.data[ pos ];
+    }
+    gsl_NODISCARD reference
+    front()
+    {
+        gsl_Expects( impl_.size != 0 );
+        return impl_.data[ 0 ];
+    }
+    gsl_NODISCARD const_reference
+    front() const
+    {
+        gsl_Expects( impl_.size != 0 );
+        return impl_.data[ 0 ];
+    }
+    gsl_NODISCARD reference
+    back()
+    {
+        gsl_Expects( impl_.size != 0 );
+        return impl_.data[ impl_.size - 1 ];
+    }
+    gsl_NODISCARD const_reference
+    back() const
+    {
+        gsl_Expects( impl_.size != 0 );
+        return impl_.data[ impl_.size - 1 ];
+    }
+
+    gsl_NODISCARD friend bool
+    operator==( dyn_array const & lhs, dyn_array const & rhs )
+    {
+        if ( lhs.size() != rhs.size() )
+        {
+            return false;
+        }
+        for ( size_type i = 0; i != lhs.size(); ++i )
+        {
+            if ( !( lhs.data()[ i ] == rhs.data()[ i ] ) )
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    gsl_NODISCARD friend bool
+    operator!=( dyn_array const & lhs, dyn_array const & rhs )
+    {
+        return !( lhs == rhs );
+    }
+};
+
+#endif // gsl_FEATURE( EXPERIMENTAL_DYN_ARRAY ) && gsl_STDLIB_CPP11_OR_GREATER
+
+#if gsl_FEATURE( EXPERIMENTAL_SMALL_BUFFER ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+
+//
+// small_buffer<> - Scratch buffer with inline storage for up to N elements.
+//
+// Larger buffers are obtained from the allocator. The elements are default-initialized, so elements of trivial type are left
+// uninitialized. The buffer is accessed only as a `span<>`.
+
+template< class T, std::size_t N, class Alloc = std::allocator< T > >
+class small_buffer
+{
+public:
+    typedef T value_type;
+    typedef Alloc allocator_type;
+    typedef std::size_t size_type;
+
+private:
+    typedef std::allocator_traits< Alloc > traits;
+
+    static_assert( N != 0, "small_buffer<T, N>: N must not be zero" );
+    static_assert( std::is_same< typename Alloc::value_type, T >::value, "small_buffer<T, N, Alloc>: Alloc::value_type must be T" );
+    static_assert( std::is_same< typename traits::pointer, T * >::value, "small_buffer<T, N, Alloc>: fancy pointers are not supported" );
+
+    // The allocator is a base class to benefit from the empty base optimization.
+    struct impl : Alloc
+    {
+        T * data;
+        std::size_t size;
+
+        explicit impl( Alloc const & alloc ) gsl_noexcept
+        : Alloc( alloc ), data( gsl_nullptr ), size( 0 )
+        {
+        }
+    } impl_;
+    alignas( T ) unsigned char inline_[ N * sizeof( T ) ];
+
+    T *
+    inline_data() gsl_noexcept
+    {
+        return static_cast< T * >( static_cast< void * >( inline_ ) );
+    }
+
+    void
+    release( T * data, std::size_t n, std::size_t constructed ) gsl_noexcept
+    {
+        while ( constructed != 0 )
+        {
+            data[ --constructed ].~T();
+        }
+        if ( data != inline_data() )
+        {
+            traits::deallocate( impl_, data, n );
+        }
+    }
+
+public:
+    explicit small_buffer( size_type n, Alloc const & alloc = Alloc() )
+    : impl_( alloc )
+    {
+        T * data = inline_data();
+        if ( n > N )
+        {
+            gsl_Expects( n <= traits::max_size( impl_ ) );
+            data = traits::allocate( impl_, n );
+        }
+        struct release_on_failure
+        {
+            small_buffer * self;
+            T * data;
+            std::size_t n;
+            std::size_t constructed;
+            ~release_on_failure() { if ( self ) self->release( data, n, constructed ); }
+        } guard = { this, data, n, 0 };
+        for ( ; guard.constructed != n; ++guard.constructed )
+        {
+            ::new( static_cast< void * >( data + guard.constructed ) ) T;
+        }
+        guard.self = gsl_nullptr;
+        impl_.data = data;
+        impl_.size = n;
+    }
+
+    ~small_buffer()
+    {
+        release( impl_.data, impl_.size, impl_.size );
+    }
+
+    gsl_NODISCARD size_type
+    size() const gsl_noexcept
+    {
+        return impl_.size;
+    }
+    gsl_NODISCARD static gsl_constexpr size_type
+    inline_capacity() gsl_noexcept
+    {
+        return N;
+    }
+    // Returns whether the elements are stored inline.
+    gsl_NODISCARD bool
+    is_inline() const gsl_noexcept
+    {
+        return impl_.size <= N;
+    }
+    gsl_NODISCARD allocator_type
+    get_allocator() const gsl_noexcept
+    {
+        return impl_;
+    }
+
+    gsl_NODISCARD span< T >
+    as_span() gsl_noexcept
+    {
+        return span< T >( impl_.data, static_cast< typename span< T >::size_type >( impl_.size ) );
+    }
+    gsl_NODISCARD span< T const >
+    as_span() const gsl_noexcept
+    {
+        return span< T const >( impl_.data, static_cast< typename span< T const >::size_type >( impl_.size ) );
+    }
+    operator span< T >() gsl_noexcept
+    {
+        return as_span();
+    }
+    operator span< T const >() const gsl_noexcept
+    {
+        return as_span();
+    }
+
+gsl_is_delete_access:
+    small_buffer( small_buffer const & ) gsl_is_delete;
+    small_buffer & operator=( small_buffer const & ) gsl_is_delete;
+};
+
+#endif // gsl_FEATURE( EXPERIMENTAL_SMALL_BUFFER ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+
+#if gsl_FEATURE( EXPERIMENTAL_SPSC_RING ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+
+//
+// spsc_ring<> - Wait-free single-producer/single-consumer queue over caller-supplied storage.
+//
+// The size of the storage must be a power of 2. Head and tail increase monotonically and are reduced modulo the capacity on
+// access. Producer and consumer state are kept on separate cache lines, and each side caches the index of the other side,
+// which it reloads only when the queue appears to be full or empty, respectively.
+//
+// The `try_push()` functions must only be called by a single producer thread, and `try_pop()`, `peek()`, and `consume()` must only
+// be called by a single consumer thread.
+
+template< class T >
+class spsc_ring
+{
+public:
+    typedef T value_type;
+    typedef std::size_t size_type;
+
+    // Readable elements in queue order. `second` is non-empty if the elements wrap around the end of the storage.
+    struct segments
+    {
+        span< T > first;
+        span< T > second;
+
+        gsl_NODISCARD size_type
+        size() const gsl_noexcept
+        {
+            return static_cast< size_type >( first.size() ) + static_cast< size_type >( second.size() );
+        }
+    };
+
+private:
+    T * data_;
+    std::size_t mask_;
+
+    struct alignas( gsl_CONFIG_CACHE_LINE_SIZE ) producer_state
+    {
+        std::atomic< std::size_t > tail;
+        std::size_t cached_head;
+    } producer_;
+    struct alignas( gsl_CONFIG_CACHE_LINE_SIZE ) consumer_state
+    {
+        std::atomic< std::size_t > head;
+        std::size_t cached_tail;
+    } consumer_;
+
+    // Returns the number of free elements, reloading the head if fewer than `wanted` elements are known to be free.
+    std::size_t
+    writable( std::size_t tail, std::size_t wanted ) gsl_noexcept
+    {
+        std::size_t n = capacity() - ( tail - producer_.cached_head );
+        if ( n < wanted )
+        {
+            producer_.cached_head = consumer_.head.load( std::memory_order_acquire );
+            n = capacity() - ( tail - producer_.cached_head );
+        }
+        return n;
+    }
+    // Returns the number of readable elements, reloading the tail if fewer than `wanted` elements are known to be readable.
+    std::size_t
+    readable( std::size_t head, std::size_t wanted ) gsl_noexcept
+    {
+        std::size_t n = consumer_.cached_tail - head;
+        if ( n < wanted )
+        {
+            consumer_.cached_tail = producer_.tail.load( std::memory_order_acquire );
+            n = consumer_.cached_tail - head;
+        }
+        return n;
+    }
+
+public:
+    // Precondition: `storage.size()` is a power of 2.
+    explicit spsc_ring( span< T > storage )
+    : data_( storage.data() ), mask_( static_cast< std::size_t >( storage.size() ) - 1 )
+    {
+        gsl_Expects( storage.size() != 0 && ( storage.size() & ( storage.size() - 1 ) ) == 0 );
+        producer_.tail.store( 0, std::memory_order_relaxed );
+        producer_.cached_head = 0;
+        consumer_.head.store( 0, std::memory_order_relaxed );
+        consumer_.cached_tail = 0;
+    }
+
+    gsl_NODISCARD size_type
+    capacity() const gsl_noexcept
+    {
+        return mask_ + 1;
+    }
+    // Returns the number of elements in the queue. If the queue is accessed concurrently, the result may be outdated.
+    gsl_NODISCARD size_type
+    size() const gsl_noexcept
+    {
+        std::size_t const head = consumer_.head.load( std::memory_order_acquire );
+        return producer_.tail.load( std::memory_order_acquire ) - head;
+    }
+
+    // Returns `false` if the queue is full.
+    bool
+    try_push( T const & value )
+    {
+        std::size_t const tail = producer_.tail.load( std::memory_order_relaxed );
+        if ( writable( tail, 1 ) == 0 )
+        {
+            return false;
+        }
+        data_[ tail & mask_ ] = value;
+        producer_.tail.store( tail + 1, std::memory_order_release );
+        return true;
+    }
+    bool
+    try_push( T && value )
+    {
+        std::size_t const tail = producer_.tail.load( std::memory_order_relaxed );
+        if ( writable( tail, 1 ) == 0 )
+        {
+            return false;
+        }
+        data_[ tail & mask_ ] = std::move( value );
+        producer_.tail.store( tail + 1, std::memory_order_release );
+        return true;
+    }
+    // Appends as many elements of `values` as fit and returns their number.
+    size_type
+    try_push( span< T const > values )
+    {
+        std::size_t const tail = producer_.tail.load( std::memory_order_relaxed );
+        std::size_t const wanted = static_cast< std::size_t >( values.size() );
+        std::size_t const free = writable( tail, wanted );
+        std::size_t const n = wanted < free ? wanted : free;
+        std::size_t const pos = tail & mask_;
+        std::size_t const n1 = n < capacity() - pos ? n : capacity() - pos;
+        T const * src = values.data();
+        for ( std::size_t i = 0; i != n1; ++i )
+        {
+            data_[ pos + i ] = src[ i ];
+        }
+        for ( std::size_t i = n1; i != n; ++i )
+        {
+            data_[ i - n1 ] = src[ i ];
+        }
+        producer_.tail.store( tail + n, std::memory_order_release );
+        return n;
+    }
+
+    // Returns `false` if the queue is empty.
+    bool
+    try_pop( T & value )
+    {
+        std::size_t const head = consumer_.head.load( std::memory_order_relaxed );
+        if ( readable( head, 1 ) == 0 )
+        {
+            return false;
+        }
+        value = std::move( data_[ head & mask_ ] );
+        consumer_.head.store( head + 1, std::memory_order_release );
+        return true;
+    }
+    // Moves as many elements as available into `values` and returns their number.
+    size_type
+    try_pop( span< T > values )
+    {
+        std::size_t const head = consumer_.head.load( std::memory_order_relaxed );
+        std::size_t const wanted = static_cast< std::size_t >( values.size() );
+        std::size_t const available = readable( head, wanted );
+        std::size_t const n = wanted < available ? wanted : available;
+        std::size_t const pos = head & mask_;
+        std::size_t const n1 = n < capacity() - pos ? n : capacity() - pos;
+        T * dst = values.data();
+        for ( std::size_t i = 0; i != n1; ++i )
+        {
+            dst[ i ] = std::move( data_[ pos + i ] );
+        }
+        for ( std::size_t i = n1; i != n; ++i )
+        {
+            dst[ i ] = std::move( data_[ i - n1 ] );
+        }
+        consumer_.head.store( head + n, std::memory_order_release );
+        return n;
+    }
+
+    // Returns the readable elements without removing them from the queue. They remain valid until they are consumed.
+    gsl_NODISCARD segments
+    peek() gsl_noexcept
+    {
+        std::size_t const head = consumer_.head.load( std::memory_order_relaxed );
+        std::size_t const n = readable( head, capacity() );
+        std::size_t const pos = head & mask_;
+        std::size_t const n1 = n < capacity() - pos ? n : capacity() - pos;
+        segments result = {
+            span< T >( data_ + pos, static_cast< typename span< T >::size_type >( n1 ) ),
+            span< T >( data_, static_cast< typename span< T >::size_type >( n - n1 ) )
+        };
+        return result;
+    }
+    // Removes the first `n` elements from the queue, typically after processing them in place with `peek()`.
+    void
+    consume( size_type n )
+    {
+        std::size_t const head = consumer_.head.load( std::memory_order_relaxed );
+        gsl_Expects( n <= readable( head, n ) );
+        consumer_.head.store( head + n, std::memory_order_release );
+    }
+
+gsl_is_delete_access:
+    spsc_ring( spsc_ring const & ) gsl_is_delete;
+    spsc_ring & operator=( spsc_ring const & ) gsl_is_delete;
+};
+
+#endif // gsl_FEATURE( EXPERIMENTAL_SPSC_RING ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+
+#if gsl_FEATURE( EXPERIMENTAL_MPMC_QUEUE ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+
+//
+// mpmc_queue<> - Bounded multi-producer/multi-consumer queue with per-slot sequence numbers (after Dmitry Vyukov).
+//
+// The queue operates on caller-supplied storage whose size must be a power of 2. The sequence number of a slot tells whether
+// it is ready to be written at a given enqueue position or ready to be read at a given dequeue position, so producers and
+// consumers synchronize only through the slot they access and through a CAS on their respective position counter. Batched
+// operations claim several consecutive positions with a single CAS.
+
+template< class T >
+class mpmc_queue
+{
+public:
+    typedef T value_type;
+    typedef std::size_t size_type;
+
+    struct slot
+    {
+        std::atomic< std::size_t > sequence;
+        T value;
+    };
+
+private:
+    slot * slots_;
+    std::size_t mask_;
+    alignas( gsl_CONFIG_CACHE_LINE_SIZE ) std::atomic< std::size_t > enqueue_pos_;
+    alignas( gsl_CONFIG_CACHE_LINE_SIZE ) std::atomic< std::size_t > dequeue_pos_;
+
+    // Claims up to `wanted` consecutive positions of `pos_` whose slots have the sequence number `position + offset`.
+    // Returns the number of positions claimed; `first` receives the first of them.
+    std::size_t
+    claim( std::atomic< std::size_t > & pos_, std::size_t offset, std::size_t wanted, std::size_t & first ) gsl_noexcept
+    {
+        std::size_t pos = pos_.load( std::memory_order_relaxed );
+        for ( ;; )
+        {
+            std::size_t n = 0;
+            bool outdated = false;
+            for ( ; n != wanted && n <= mask_; ++n )
+            {
+                std::size_t const seq = slots_[ ( pos + n ) & mask_ ].sequence.load( std::memory_order_acquire );
+                std::ptrdiff_t const diff = static_cast< std::ptrdiff_t >( seq - ( pos + n + offset ) );
+                if ( diff != 0 )
+                {
+                    // A positive difference for the first slot means that other threads have claimed `pos` already.
+                    outdated = n == 0 && diff > 0;
+                    break;
+                }
+            }
+            if ( outdated )
+            {
+                pos = pos_.load( std::memory_order_relaxed );
+            }
+            else if ( n == 0 )
+            {
+                return 0;
+            }
+            else if ( pos_.compare_exchange_weak( pos, pos + n, std::memory_order_relaxed ) )
+            {
+                first = pos;
+                return n;
+            }
+        }
+    }
+
+public:
+    // Precondition: `storage.size()` is a power of 2.
+    explicit mpmc_queue( span< slot > storage )
+    : slots_( storage.data() ), mask_( static_cast< std::size_t >( storage.size() ) - 1 )
+    {
+        gsl_Expects( storage.size() != 0 && ( storage.size() & ( storage.size() - 1 ) ) == 0 );
+        for ( std::size_t i = 0; i <= mask_; ++i )
+        {
+            slots_[ i ].sequence.store( i, std::memory_order_relaxed );
+        }
+        enqueue_pos_.store( 0, std::memory_order_relaxed );
+        dequeue_pos_.store( 0, std::memory_order_relaxed );
+    }
+
+    gsl_NODISCARD size_type
+    capacity() const gsl_noexcept
+    {
+        return mask_ + 1;
+    }
+
+    // Returns `false` if the queue is full.
+    bool
+    try_push( T const & value )
+    {
+        std::size_t pos;
+        if ( claim( enqueue_pos_, 0, 1, pos ) == 0 )
+        {
+            return false;
+        }
+        slot & s = slots_[ pos & mask_ ];
+        s.value = value;
+        s.sequence.store( pos + 1, std::memory_order_release );
+        return true;
+    }
+    bool
+    try_push( T && value )
+    {
+        std::size_t pos;
+        if ( claim( enqueue_pos_, 0, 1, pos ) == 0 )
+        {
+            return false;
+        }
+        slot & s = slots_[ pos & mask_ ];
+        s.value = std::move( value );
+        s.sequence.store( pos + 1, std::memory_order_release );
+        return true;
+    }
+    // Enqueues a prefix of `values` with consecutive positions and returns its length, which is 0 only if the queue is full.
+    size_type
+    try_push( span< T const > values )
+    {
+        std::size_t pos;
+        std::size_t const n = claim( enqueue_pos_, 0, static_cast< std::size_t >( values.size() ), pos );
+        T const * src = values.data();
+        for ( std::size_t i = 0; i != n; ++i )
+        {
+            slot & s = slots_[ ( pos + i ) & mask_ ];
+            s.value = src[ i ];
+            s.sequence.store( pos + i + 1, std::memory_order_release );
+        }
+        return n;
+    }
+
+    // Returns `false` if the queue is empty.
+    bool
+    try_pop( T & value )
+    {
+        std::size_t pos;
+        if ( claim( dequeue_pos_, 1, 1, pos ) == 0 )
+        {
+            return false;
+        }
+        slot & s = slots_[ pos & mask_ ];
+        value = std::move( s.value );
+        s.sequence.store( pos + mask_ + 1, std::memory_order_release );
+        return true;
+    }
+    // Dequeues consecutive elements into a prefix of `values` and returns its length, which is 0 only if the queue is empty.
+    size_type
+    try_pop( span< T > values )
+    {
+        std::size_t pos;
+        std::size_t const n = claim( dequeue_pos_, 1, static_cast< std::size_t >( values.size() ), pos );
+        T * dst = values.data();
+        for ( std::size_t i = 0; i != n; ++i )
+        {
+            slot & s = slots_[ ( pos + i ) & mask_ ];
+            dst[ i ] = std::move( s.value );
+            s.sequence.store( pos + i + mask_ + 1, std::memory_order_release );
+        }
+        return n;
+    }
+
+gsl_is_delete_access:
+    mpmc_queue( mpmc_queue const & ) gsl_is_delete;
+    mpmc_queue & operator=( mpmc_queue const & ) gsl_is_delete;
+};
+
+//
+// blocking_mpmc_queue<> - `mpmc_queue<>` with blocking `push()` and `pop()`.
+//
+// Blocked threads sleep with `std::atomic<>::wait()` if available (C++20), and spin with `std::this_thread::yield()` otherwise.
+// Threads which make progress only notify if other threads are blocked.
+
+template< class T >
+class blocking_mpmc_queue
+{
+public:
+    typedef T value_type;
+    typedef std::size_t size_type;
+    typedef typename mpmc_queue< T >::slot slot;
+
+private:
+    struct alignas( gsl_CONFIG_CACHE_LINE_SIZE ) waiters
+    {
+        std::atomic< unsigned > count;  // number of blocked threads
+        std::atomic< unsigned > epoch;  // changed to wake up blocked threads
+    };
+
+    mpmc_queue< T > queue_;
+    waiters producers_;  // blocked because the queue is full
+    waiters consumers_;  // blocked because the queue is empty
+
+    // The read-modify-write operations on `count` ensure that either the blocked thread sees the progress made by the calling
+    // thread, or the calling thread sees that there is a blocked thread.
+    static void
+    notify( waiters & w ) gsl_noexcept
+    {
+        if ( w.count.fetch_add( 0, std::memory_order_acq_rel ) != 0 )
+        {
+            w.epoch.fetch_add( 1, std::memory_order_release );
+# if defined( __cpp_lib_atomic_wait )
+            w.epoch.notify_all();
+# endif
+        }
+    }
+
+    // Blocks until `f()` returns true.
+    template< class F >
+    static void
+    wait_until( waiters & w, F f )
+    {
+        while ( ! f() )
+        {
+            w.count.fetch_add( 1, std::memory_order_acq_rel );
+            unsigned const epoch = w.epoch.load( std::memory_order_acquire );
+            if ( f() )
+            {
+                w.count.fetch_sub( 1, std::memory_order_relaxed );
+                return;
+            }
+# if defined( __cpp_lib_atomic_wait )
+            w.epoch.wait( epoch, std::memory_order_acquire );
+# else
+            while ( w.epoch.load( std::memory_order_acquire ) == epoch )
+            {
+                std::this_thread::yield();
+            }
+# endif
+            w.count.fetch_sub( 1, std::memory_order_relaxed );
+        }
+    }
+
+public:
+    // Precondition: `storage.size()` is a power of 2.
+    explicit blocking_mpmc_queue( span< slot > storage )
+    : queue_( storage )
+    {
+        producers_.count.store( 0, std::memory_order_relaxed );
+        producers_.epoch.store( 0, std::memory_order_relaxed );
+        consumers_.count.store( 0, std::memory_order_relaxed );
+        consumers_.epoch.store( 0, std::memory_order_relaxed );
+    }
+
+    gsl_NODISCARD size_type
+    capacity() const gsl_noexcept
+    {
+        return queue_.capacity();
+    }
+
+    bool
+    try_push( T const & value )
+    {
+        bool const result = queue_.try_push( value );
+        if ( result )
+        {
+            notify( consumers_ );
+        }
+        return result;
+    }
+    bool
+    try_pop( T & value )
+    {
+        bool const result = queue_.try_pop( value );
+        if ( result )
+        {
+            notify( producers_ );
+        }
+        return result;
+    }
+
+    // Blocks while the queue is full.
+    void
+    push( T const & value )
+    {
+        wait_until( producers_, [ this, &value ]() { return queue_.try_push( value ); } );
+        notify( consumers_ );
+    }
+    void
+    push( T && value )
+    {
+        wait_until( producers_, [ this, &value ]() { return queue_.try_push( std::move( value ) ); } );
+        notify( consumers_ );
+    }
+    // Blocks until all elements have been enqueued.
+    void
+    push( span< T const > values )
+    {
+        while ( ! values.empty() )
+        {
+            size_type n = 0;
+            wait_until( producers_, [ this, &values, &n ]() { n = queue_.try_push( values ); return n != 0; } );
+            notify( consumers_ );
+            values = values.subspan( static_cast< typename span< T const >::size_type >( n ) );
+        }
+    }
+
+    // Blocks while the queue is empty.
+    gsl_NODISCARD T
+    pop()
+    {
+        T value;
+        wait_until( consumers_, [ this, &value ]() { return queue_.try_pop( value ); } );
+        notify( producers_ );
+        return value;
+    }
+    // Blocks while the queue is empty, then dequeues up to `values.size()` elements and returns their number.
+    size_type
+    pop( span< T > values )
+    {
+        size_type n = 0;
+        if ( ! values.empty() )
+        {
+            wait_until( consumers_, [ this, &values, &n ]() { n = queue_.try_pop( values ); return n != 0; } );
+            notify( producers_ );
+        }
+        return n;
+    }
+
+gsl_is_delete_access:
+    blocking_mpmc_queue( blocking_mpmc_queue const & ) gsl_is_delete;
+    blocking_mpmc_queue & operator=( blocking_mpmc_queue const & ) gsl_is_delete;
+};
+
+#endif // gsl_FEATURE( EXPERIMENTAL_MPMC_QUEUE ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+
+#if gsl_FEATURE( EXPERIMENTAL_CIRCULAR_SPAN ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+
+//
+// circular_span<> - View of a sequence of elements stored in two contiguous segments, such as the contents of a ring buffer.
+//
+// The sequence consists of the elements of the first segment followed by the elements of the second segment. Operations which
+// select a part of the sequence split it at the seam between the segments as necessary.
+
+template< class T >
+class circular_span
+{
+public:
+    typedef T element_type;
+    typedef typename std::remove_cv< T >::type value_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef T & reference;
+    typedef T * pointer;
+
+    class iterator
+    {
+    private:
+        T * first_;
+        T * second_;
+        std::size_t first_size_;
+        std::size_t index_;
+
+        friend class circular_span;
+
+        iterator( T * first, std::size_t first_size, T * second, std::size_t index ) gsl_noexcept
+        : first_( first ), second_( second ), first_size_( first_size ), index_( index )
+        {
+        }
+
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef typename std::remove_cv< T >::type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef T * pointer;
+        typedef T & reference;
+
+        iterator() gsl_noexcept
+        : first_( gsl_nullptr ), second_( gsl_nullptr ), first_size_( 0 ), index_( 0 )
+        {
+        }
+
+        gsl_NODISCARD reference
+        operator*() const gsl_noexcept
+        {
+            return index_ < first_size_ ? first_[ index_ ] : second_[ index_ - first_size_ ];
+        }
+        gsl_NODISCARD pointer
+        operator->() const gsl_noexcept
+        {
+            return gsl_ADDRESSOF( **this );
+        }
+        gsl_NODISCARD reference
+        operator[]( difference_type n ) const gsl_noexcept
+        {
+            return *( *this + n );
+        }
+
+        iterator &
+        operator++() gsl_noexcept
+        {
+            ++index_;
+            return *this;
+        }
+        iterator
+        operator++( int ) gsl_noexcept
+        {
+            iterator result = *this;
+            ++index_;
+            return result;
+        }
+        iterator &
+        operator--() gsl_noexcept
+        {
+            --index_;
+            return *this;
+        }
+        iterator
+        operator--( int ) gsl_noexcept
+        {
+            iterator result = *this;
+            --index_;
+            return result;
+        }
+        iterator &
+        operator+=( difference_type n ) gsl_noexcept
+        {
+            index_ += static_cast< std::size_t >( n );
+            return *this;
+        }
+        iterator &
+        operator-=( difference_type n ) gsl_noexcept
+        {
+            index_ -= static_cast< std::size_t >( n );
+            return *this;
+        }
+        gsl_NODISCARD friend iterator
+        operator+( iterator it, difference_type n ) gsl_noexcept
+        {
+            return it += n;
+        }
+        gsl_NODISCARD friend iterator
+        operator+( difference_type n, iterator it ) gsl_noexcept
+        {
+            return it += n;
+        }
+        gsl_NODISCARD friend iterator
+        operator-( iterator it, difference_type n ) gsl_noexcept
+        {
+            return it -= n;
+        }
+        gsl_NODISCARD friend difference_type
+        operator-( iterator const & lhs, iterator const & rhs ) gsl_noexcept
+        {
+            return static_cast< difference_type >( lhs.index_ - rhs.index_ );
+        }
+
+        gsl_NODISCARD friend bool operator==( iterator const & lhs, iterator const & rhs ) gsl_noexcept { return lhs.index_ == rhs.index_; }
+        gsl_NODISCARD friend bool operator!=( iterator const & lhs, iterator const & rhs ) gsl_noexcept { return lhs.index_ != rhs.index_; }
+        gsl_NODISCARD friend bool operator< ( iterator const & lhs, iterator const & rhs ) gsl_noexcept { return lhs.index_ <  rhs.index_; }
+        gsl_NODISCARD friend bool operator<=( iterator const & lhs, iterator const & rhs ) gsl_noexcept { return lhs.index_ <= rhs.index_; }
+        gsl_NODISCARD friend bool operator> ( iterator const & lhs, iterator const & rhs ) gsl_noexcept { return lhs.index_ >  rhs.index_; }
+        gsl_NODISCARD friend bool operator>=( iterator const & lhs, iterator const & rhs ) gsl_noexcept { return lhs.index_ >= rhs.index_; }
+    };
+    typedef std::reverse_iterator< iterator > reverse_iterator;
+
+private:
+    span< T > first_;
+    span< T > second_;
+
+    static span< T >
+    make( T * data, std::size_t size ) gsl_noexcept
     {
+        return span< T >( data, static_cast< typename span< T >::size_type >( size ) );
     }
-#  else // gsl_BETWEEN( gsl_COMPILER_MSVC_VERSION, 1, 140 )
-    template< class Container
-        gsl_ENABLE_IF_(( detail::is_compatible_container< Container, element_type >::value ))
-    >
-    gsl_api gsl_constexpr span( Container & cont ) gsl_noexcept
-        : storage_( std17::data( cont ), std17::size( cont ) )
+    std::size_t
+    first_size() const gsl_noexcept
     {
+        return static_cast< std::size_t >( first_.size() );
     }
-    template< class Container, gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
-        gsl_ENABLE_IF_(( std::is_const< element_type >::value &&
-                         detail::is_compatible_container< Container, element_type >::value ))
-    >
-    gsl_api gsl_constexpr span( Container const & cont ) gsl_noexcept
-        : storage_( std17::data( cont ), std17::size( cont ) )
+    std::size_t
+    second_size() const gsl_noexcept
     {
+        return static_cast< std::size_t >( second_.size() );
     }
-#  endif // ! gsl_BETWEEN( gsl_COMPILER_MSVC_VERSION, 1, 140 )
-# elif gsl_HAVE( UNCONSTRAINED_SPAN_CONTAINER_CTOR )
-    template< class Container >
-    gsl_constexpr span( Container & cont )
-        : storage_( cont.size() == 0 ? gsl_nullptr : gsl_ADDRESSOF( cont[0] ), cont.size() )
+
+public:
+    circular_span() gsl_noexcept
+    : first_(), second_()
     {
     }
-    template< class Container >
-    gsl_constexpr span( Container const & cont )
-        : storage_( cont.size() == 0 ? gsl_nullptr : gsl_ADDRESSOF( cont[0] ), cont.size() )
+    circular_span( span< T > first, span< T > second ) gsl_noexcept
+    : first_( first ), second_( second )
     {
     }
-# endif
-
-# if gsl_FEATURE_TO_STD( WITH_CONTAINER )
-    template< class Container >
-    gsl_constexpr span( with_container_t, Container & cont )
-        : storage_( cont.size() == 0 ? gsl_nullptr : gsl_ADDRESSOF( cont[0] ), cont.size() )
+    // Views `count` elements of the ring buffer `storage`, starting at position `offset` and wrapping around its end.
+    circular_span( span< T > storage, size_type offset, size_type count )
     {
+        std::size_t const size = static_cast< std::size_t >( storage.size() );
+        gsl_Expects( offset < size || ( offset == 0 && size == 0 ) );
+        gsl_Expects( count <= size );
+        std::size_t const n1 = count < size - offset ? count : size - offset;
+        first_ = make( storage.data() + offset, n1 );
+        second_ = make( storage.data(), count - n1 );
     }
-    template< class Container >
-    gsl_constexpr span( with_container_t, Container const & cont )
-        : storage_( cont.size() == 0 ? gsl_nullptr : gsl_ADDRESSOF( cont[0] ), cont.size() )
+    template< class U
+        gsl_ENABLE_IF_(( std::is_convertible< U(*)[], T(*)[] >::value ))
+    >
+    circular_span( circular_span< U > const & other ) gsl_noexcept
+    : first_( other.first_segment() ), second_( other.second_segment() )
     {
     }
-# endif
 
-# if gsl_HAVE( IS_DEFAULT ) && ! gsl_BETWEEN( gsl_COMPILER_GNUC_VERSION, 430, 600)
-    gsl_constexpr span( span && ) gsl_noexcept = default;
-    gsl_constexpr span( span const & ) = default;
-# else
-    gsl_api gsl_constexpr span( span const & other )
-        : storage_( other.storage_ )
+    gsl_NODISCARD span< T >
+    first_segment() const gsl_noexcept
     {
+        return first_;
     }
-# endif
-
-# if gsl_HAVE( IS_DEFAULT )
-    gsl_constexpr14 span & operator=( span && ) gsl_noexcept = default;
-    gsl_constexpr14 span & operator=( span const & ) gsl_noexcept = default;
-# else
-    gsl_constexpr14 span & operator=( span const & other ) gsl_noexcept
+    gsl_NODISCARD span< T >
+    second_segment() const gsl_noexcept
     {
-        storage_ = other.storage_;
-        return *this;
+        return second_;
     }
-# endif
 
-# if gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( DEFAULT_FUNCTION_TEMPLATE_ARG ) && ! gsl_BETWEEN( gsl_COMPILER_MSVC_VERSION, 1, 140 )
-    template<
-        class OtherElementType, gsl_CONFIG_SPAN_INDEX_TYPE OtherExtent, gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
-        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
-        gsl_ENABLE_IF_NTTP_(( ( MyExtent == dynamic_extent || MyExtent == OtherExtent ) &&
-                              detail::is_allowed_element_type_conversion< OtherElementType, element_type >::value ))
-    >
-    gsl_api gsl_constexpr span( span< OtherElementType, OtherExtent > const & other ) gsl_noexcept
-        : storage_( other.data(), detail::extent_type< OtherExtent >( other.size() ) )
+    gsl_NODISCARD size_type
+    size() const gsl_noexcept
     {
+        return first_size() + second_size();
     }
-    template<
-        class OtherElementType, gsl_CONFIG_SPAN_INDEX_TYPE OtherExtent, gsl_CONFIG_SPAN_INDEX_TYPE MyExtent = Extent
-        // We *have* to use SFINAE with an NTTP arg here, otherwise the overload is ambiguous.
-        gsl_ENABLE_IF_NTTP_(( MyExtent != dynamic_extent && OtherExtent == dynamic_extent &&
-                              detail::is_allowed_element_type_conversion< OtherElementType, element_type >::value ))
-    >
-    gsl_api gsl_constexpr gsl_explicit span( span< OtherElementType, OtherExtent > const & other ) gsl_noexcept
-        : storage_( other.data(), detail::extent_type< OtherExtent >( other.size() ) )
+    gsl_NODISCARD bool
+    empty() const gsl_noexcept
     {
+        return size() == 0;
     }
-# else // !( gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( DEFAULT_FUNCTION_TEMPLATE_ARG ) && ! gsl_BETWEEN( gsl_COMPILER_MSVC_VERSION, 1, 140 ) )
-    template< class OtherElementType, gsl_CONFIG_SPAN_INDEX_TYPE OtherExtent >
-    gsl_api gsl_constexpr14 span( span< OtherElementType, OtherExtent > const & other )
-        : storage_( other.data(), detail::extent_type< OtherExtent >( other.size() ) )
+
+    gsl_NODISCARD reference
+    operator[]( size_type pos ) const
     {
-        gsl_STATIC_ASSERT_(
-            Extent == dynamic_extent || OtherExtent == dynamic_extent || Extent == OtherExtent,
-            "attempting copy-construction from incompatible span" );
-        gsl_Expects( Extent == dynamic_extent || other.size() == Extent );
+        gsl_Expects( pos < size() );
+        return pos < first_size() ? first_.data()[ pos ] : second_.data()[ pos - first_size() ];
     }
-# endif // gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( DEFAULT_FUNCTION_TEMPLATE_ARG ) && ! gsl_BETWEEN( gsl_COMPILER_MSVC_VERSION, 1, 140 )
-
-    // [span.sub], span subviews
-
-    template< gsl_CONFIG_SPAN_INDEX_TYPE Count >
-    gsl_NODISCARD gsl_api gsl_constexpr14 span< element_type, Count >
-    first() const
+    gsl_NODISCARD reference
+    front() const
     {
-        gsl_STATIC_ASSERT_(
-            Extent == dynamic_extent || Count <= Extent,
-            "first() cannot extract more elements from a span than it contains" );
-        gsl_Expects( static_cast<std::size_t>( Count ) <= static_cast<std::size_t>( size() ) );
-        return span< element_type, Count >( data(), Count );
+        gsl_Expects( ! empty() );
+        return ( *this )[ 0 ];
     }
-
-    template< gsl_CONFIG_SPAN_INDEX_TYPE Count >
-    gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
-    gsl_NODISCARD gsl_api gsl_constexpr14 span< element_type, Count >
-    last() const
+    gsl_NODISCARD reference
+    back() const
     {
-        gsl_STATIC_ASSERT_(
-            Extent == dynamic_extent || Count <= Extent,
-            "last() cannot extract more elements from a span than it contains" );
-        gsl_Expects( static_cast<std::size_t>( Count ) <= static_cast<std::size_t>( size() ) );
-        return span< element_type, Count >( data() + ( size() - Count ), Count );
+        gsl_Expects( ! empty() );
+        return ( *this )[ size() - 1 ];
     }
 
-    template< gsl_CONFIG_SPAN_INDEX_TYPE Offset, gsl_CONFIG_SPAN_INDEX_TYPE Count >
-    gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
-    gsl_NODISCARD gsl_api gsl_constexpr14 typename detail::calculate_subspan_type< T, Extent, Offset, Count >::type
-    subspan() const
+    gsl_NODISCARD iterator
+    begin() const gsl_noexcept
     {
-        gsl_STATIC_ASSERT_(
-            Extent == dynamic_extent || ( Extent >= Offset && ( Count == dynamic_extent ||
-                                                                Count <= Extent - Offset ) ),
-            "subspan() cannot extract more elements from a span than it contains.");
-        gsl_Expects( static_cast<std::size_t>( size() ) >= static_cast<std::size_t>( Offset ) &&
-                     ( Count == dynamic_extent || static_cast<std::size_t>( Count ) <= static_cast<std::size_t>( size() ) - static_cast<std::size_t>( Offset ) ) );
-        typedef typename detail::calculate_subspan_type< T, Extent, Offset, Count >::type type;
-        return type( data() + Offset, Count == dynamic_extent ? size() - Offset : Count );
+        return iterator( first_.data(), first_size(), second_.data(), 0 );
     }
-    template< gsl_CONFIG_SPAN_INDEX_TYPE Offset >
-    gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
-    gsl_NODISCARD gsl_api gsl_constexpr14 typename detail::calculate_subspan_type< T, Extent, Offset, dynamic_extent >::type
-    subspan() const
+    gsl_NODISCARD iterator
+    end() const gsl_noexcept
     {
-        gsl_STATIC_ASSERT_(
-            Extent == dynamic_extent || Extent >= Offset,
-            "subspan() cannot extract more elements from a span than it contains.");
-        gsl_Expects( static_cast<std::size_t>( size() ) >= static_cast<std::size_t>( Offset ) );
-        typedef typename detail::calculate_subspan_type< T, Extent, Offset, dynamic_extent >::type type;
-        return type( data() + Offset, size() - Offset );
+        return iterator( first_.data(), first_size(), second_.data(), size() );
     }
-
-    gsl_NODISCARD gsl_api gsl_constexpr14 span< element_type, dynamic_extent >
-    first( size_type count ) const
+    gsl_NODISCARD reverse_iterator
+    rbegin() const gsl_noexcept
     {
-        gsl_Expects( static_cast<std::size_t>( count ) <= static_cast<std::size_t>( size() ) );
-        return span< element_type, dynamic_extent >( data(), count );
+        return reverse_iterator( end() );
     }
-    gsl_NODISCARD gsl_api gsl_constexpr14 span< element_type, dynamic_extent >
-    last( size_type count ) const
+    gsl_NODISCARD reverse_iterator
+    rend() const gsl_noexcept
     {
-        gsl_Expects( static_cast<std::size_t>( count ) <= static_cast<std::size_t>( size() ) );
-        return make_subspan( size() - count, dynamic_extent, subspan_selector< Extent >() );
+        return reverse_iterator( begin() );
     }
 
-    gsl_NODISCARD gsl_api gsl_constexpr14 span<element_type, dynamic_extent>
-    subspan(size_type offset, size_type count = dynamic_extent) const
+    // Returns the `count` elements starting at position `offset`, or all elements starting at `offset` if `count` is `dynamic_extent`.
+    gsl_NODISCARD circular_span
+    subspan( size_type offset, size_type count = static_cast< size_type >( dynamic_extent ) ) const
     {
-        return make_subspan(offset, count, subspan_selector< Extent >() );
+        gsl_Expects( offset <= size() );
+        if ( count == static_cast< size_type >( dynamic_extent ) )
+        {
+            count = size() - offset;
+        }
+        gsl_Expects( count <= size() - offset );
+        if ( offset >= first_size() )
+        {
+            return circular_span( make( second_.data() + ( offset - first_size() ), count ), span< T >() );
+        }
+        std::size_t const n1 = count < first_size() - offset ? count : first_size() - offset;
+        return circular_span( make( first_.data() + offset, n1 ), make( second_.data(), count - n1 ) );
     }
-
-    // [span.obs], span observers
-
-    gsl_NODISCARD gsl_api gsl_constexpr size_type
-    size() const gsl_noexcept
+    gsl_NODISCARD circular_span
+    first( size_type count ) const
     {
-        return storage_.size();
+        gsl_Expects( count <= size() );
+        return subspan( 0, count );
     }
-    gsl_NODISCARD gsl_api gsl_constexpr std::ptrdiff_t
-    ssize() const gsl_noexcept
+    gsl_NODISCARD circular_span
+    last( size_type count ) const
     {
-        return gsl_lite::narrow_cast< std::ptrdiff_t >( storage_.size() );
+        gsl_Expects( count <= size() );
+        return subspan( size() - count, count );
     }
 
-    gsl_NODISCARD gsl_api gsl_constexpr size_type
-    size_bytes() const gsl_noexcept
+    // Returns whether all elements are stored contiguously, i.e. whether one of the segments is empty.
+    gsl_NODISCARD bool
+    is_contiguous() const gsl_noexcept
     {
-        return size() * sizeof(element_type);
+        return first_.empty() || second_.empty();
     }
-
-    gsl_NODISCARD gsl_api gsl_constexpr bool
-    empty() const gsl_noexcept
+    // Precondition: `is_contiguous()`.
+    gsl_NODISCARD span< T >
+    as_contiguous() const
     {
-        return size() == 0;
+        gsl_Expects( is_contiguous() );
+        return first_.empty() ? second_ : first_;
     }
 
-    // [span.elem], span element access
-
-    gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
-    gsl_NODISCARD gsl_api gsl_constexpr14 reference
-    operator[](size_type idx) const
+    // Copies the elements to `dest`, which must be large enough, and returns the part of `dest` written to.
+    span< value_type >
+    copy( span< value_type > dest ) const
     {
-        gsl_Expects( static_cast<std::size_t>( idx ) < static_cast<std::size_t>( size() ) );
-        return storage_.data()[ idx ];
+        gsl_Expects( size() <= static_cast< size_type >( dest.size() ) );
+        value_type * out = dest.data();
+        for ( std::size_t i = 0; i != first_size(); ++i )
+        {
+            *out++ = first_.data()[ i ];
+        }
+        for ( std::size_t i = 0; i != second_size(); ++i )
+        {
+            *out++ = second_.data()[ i ];
+        }
+        return make_span( dest.data(), static_cast< typename span< value_type >::size_type >( size() ) );
     }
+};
 
-    gsl_NODISCARD gsl_api gsl_constexpr14
-    reference front() const
-    {
-        gsl_Expects( size() > 0 );
-        return storage_.data()[ 0 ];
-    }
+#endif // gsl_FEATURE( EXPERIMENTAL_CIRCULAR_SPAN ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
 
-    gsl_NODISCARD gsl_api gsl_constexpr14
-    reference back() const
-    {
-        gsl_Expects( size() > 0 );
-        return storage_.data()[ size() - 1 ];
-    }
+#if gsl_FEATURE( EXPERIMENTAL_PARALLEL ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
 
-    gsl_NODISCARD gsl_api gsl_constexpr pointer
-    data() const gsl_noexcept
-    {
-        return storage_.data();
-    }
+//
+// thread_pool, parallel_for(), parallel_reduce() - Data-parallel loops over span<> partitions.
+//
 
-    // [span.iter], span iterator support
+namespace detail {
 
-    gsl_NODISCARD gsl_api gsl_constexpr14 iterator
-    begin() const gsl_noexcept
-    {
-        const pointer data = storage_.data();
-        gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
-        return iterator( data, data + size(), data );
-    }
-    gsl_NODISCARD gsl_api gsl_constexpr14 iterator
-    end() const gsl_noexcept
+// A set of tasks submitted to a thread_pool. Exceptions thrown by a task, e.g. by a contract check configured to throw, are
+// stored and rethrown by the thread that waits for the job.
+class parallel_job
+{
+private:
+    std::atomic< std::size_t > remaining_;
+    std::mutex done_mutex_;
+    std::condition_variable done_;
+    bool finished_;
+# if gsl_HAVE( EXCEPTIONS )
+    std::mutex error_mutex_;
+    std::exception_ptr error_;
+# endif
+
+protected:
+    virtual void run( std::size_t index ) = 0;
+
+    ~parallel_job() = default;
+
+public:
+    explicit parallel_job( std::size_t count ) gsl_noexcept
+    : remaining_( count ), finished_( count == 0 )
     {
-        const pointer data = storage_.data();
-        gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
-        const pointer endData = data + storage_.size();
-        return iterator( data, endData, endData );
     }
-    gsl_NODISCARD gsl_api gsl_constexpr14 const_iterator
-    cbegin() const gsl_noexcept
+
+    void
+    execute( std::size_t index ) gsl_noexcept
     {
-        const pointer data = storage_.data();
-        gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
-        return const_iterator( data, data + size(), data );
+# if gsl_HAVE( EXCEPTIONS )
+        try
+        {
+            run( index );
+        }
+        catch ( ... )
+        {
+            std::lock_guard< std::mutex > lock( error_mutex_ );
+            if ( ! error_ )
+            {
+                error_ = std::current_exception();
+            }
+        }
+# else
+        run( index );
+# endif
+        if ( remaining_.fetch_sub( 1, std::memory_order_acq_rel ) == 1 )
+        {
+                // The waiting thread observes `finished_` only while holding the lock, so the job is not destroyed before the
+                // lock is released.
+            std::lock_guard< std::mutex > lock( done_mutex_ );
+            finished_ = true;
+            done_.notify_all();
+        }
     }
-    gsl_NODISCARD gsl_api gsl_constexpr14 const_iterator
-    cend() const gsl_noexcept
+
+    // Blocks until all tasks are done.
+    void
+    wait()
     {
-        const pointer data = storage_.data();
-        gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
-        const pointer endData = data + storage_.size();
-        return const_iterator( data, endData, endData );
+        std::unique_lock< std::mutex > lock( done_mutex_ );
+        done_.wait( lock, [ this ] { return finished_; } );
     }
 
-    gsl_NODISCARD gsl_api gsl_constexpr14 reverse_iterator
-    rbegin() const gsl_noexcept
+    void
+    rethrow_error()
     {
-        return reverse_iterator( end() );
+# if gsl_HAVE( EXCEPTIONS )
+        if ( error_ )
+        {
+            std::rethrow_exception( error_ );
+        }
+# endif
     }
-    gsl_NODISCARD gsl_api gsl_constexpr14 reverse_iterator
-    rend() const gsl_noexcept
+};
+
+// Splits `size` elements at `data` into partitions of at least `grain` elements. If possible, partition boundaries are aligned to
+// `gsl_CONFIG_CACHE_LINE_SIZE` so that no two partitions share a cache line.
+class partitioning
+{
+private:
+    std::size_t size_;
+    std::size_t lead_;
+    std::size_t grain_;
+
+public:
+    partitioning( void const * data, std::size_t element_size, std::size_t size, std::size_t grain ) gsl_noexcept
+    : size_( size ), lead_( 0 ), grain_( grain < size ? grain : size )
     {
-        return reverse_iterator( begin() );
+            // Clamping the grain to the size keeps the arithmetic below from overflowing, as `size * element_size` bytes are
+            // addressable.
+        std::size_t const line = gsl_CONFIG_CACHE_LINE_SIZE;
+        if ( element_size < line && line % element_size == 0 )
+        {
+            std::size_t const step = line / element_size;
+            grain_ = ( grain_ + step - 1 ) / step * step;
+            std::size_t const misalignment = static_cast< std::size_t >( reinterpret_cast< std::uintptr_t >( data ) % line );
+            if ( misalignment % element_size == 0 )
+            {
+                lead_ = ( line - misalignment ) % line / element_size;
+            }
+        }
     }
 
-    gsl_NODISCARD gsl_api gsl_constexpr14 const_reverse_iterator
-    crbegin() const gsl_noexcept
+    gsl_NODISCARD std::size_t
+    count() const gsl_noexcept
     {
-        return const_reverse_iterator( cend() );
+        return size_ <= lead_ + grain_ ? 1 : 1 + ( size_ - lead_ - grain_ + grain_ - 1 ) / grain_;
     }
-    gsl_NODISCARD gsl_api gsl_constexpr14 const_reverse_iterator
-    crend() const gsl_noexcept
+    gsl_NODISCARD std::size_t
+    begin( std::size_t index ) const gsl_noexcept
     {
-        return const_reverse_iterator( cbegin() );
+        return index == 0 ? 0 : lead_ + index * grain_;
     }
-
-    gsl_constexpr14 void
-    swap( span & other ) gsl_noexcept
+    gsl_NODISCARD std::size_t
+    end( std::size_t index ) const gsl_noexcept
     {
-        std::swap( storage_, other.storage_ );
+        std::size_t const first = begin( index );
+        std::size_t const length = index == 0 ? lead_ + grain_ : grain_;
+        return size_ - first > length ? first + length : size_;
     }
+};
 
-# if ! gsl_DEPRECATE_TO_LEVEL( 9 )
-    template< class U >
-    gsl_DEPRECATED_MSG("as_span() member function is unsafe")
-    gsl_NODISCARD gsl_api typename detail::calculate_recast_span_type< element_type, U, Extent >::type
-    as_span() const
+// Calls `f( index, part )` for each partition.
+template< class T, class F >
+class partition_job : public parallel_job
+{
+private:
+    span< T > s_;
+    partitioning const & partitioning_;
+    F & f_;
+
+    void
+    run( std::size_t index ) override
     {
-        gsl_Expects( ( this->size_bytes() % sizeof( U ) ) == 0 );
-        typedef typename detail::calculate_recast_span_type< element_type, U, Extent >::type type;
-        return type( reinterpret_cast<U *>( data() ), size_bytes() / sizeof( U ) ); // NOLINT
+        std::size_t const begin = partitioning_.begin( index );
+        f_( index, s_.subspan( static_cast< typename span< T >::size_type >( begin ),
+                        static_cast< typename span< T >::size_type >( partitioning_.end( index ) - begin ) ) );
     }
-# endif // ! gsl_DEPRECATE_TO_LEVEL( 9 )
 
-# ifdef gsl_COMPILER_MS_STL_VERSION
-    // Tell MSVC how to unwrap spans in range-based-for
-    gsl_api gsl_constexpr pointer _Unchecked_begin() const gsl_noexcept { return data(); }
-    gsl_api gsl_constexpr pointer _Unchecked_end() const gsl_noexcept
+public:
+    partition_job( span< T > s, partitioning const & p, F & f ) gsl_noexcept
+    : parallel_job( p.count() ), s_( s ), partitioning_( p ), f_( f )
     {
-        gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
-        return data() + size();
     }
-# endif // gsl_COMPILER_MS_STL_VERSION
+};
 
+} // namespace detail
+
+// A pool of worker threads, each of which owns a queue of tasks. Idle workers steal tasks from the queues of other workers, and the
+// thread waiting for a job executes tasks too.
+class thread_pool
+{
 private:
-    // Needed to remove unnecessary null check in subspans
-    struct known_not_null
+    struct task
     {
-        pointer p;
+        detail::parallel_job * job;
+        std::size_t index;
+    };
+    struct task_queue
+    {
+        std::mutex mutex;
+        std::deque< task > tasks;
+    };
 
-        gsl_api gsl_constexpr known_not_null(pointer _p) gsl_noexcept
-            : p( _p )
+    std::vector< std::unique_ptr< task_queue > > queues_;
+    std::vector< std::thread > workers_;
+    std::atomic< std::size_t > next_queue_;
+    std::atomic< std::ptrdiff_t > pending_;
+    std::mutex wait_mutex_;
+    std::condition_variable wake_;
+    bool stop_;
+
+    bool
+    take( std::size_t own, task & t )
+    {
+        std::size_t const n = queues_.size();
+        for ( std::size_t i = 0; i != n; ++i )
         {
+            task_queue & q = *queues_[ ( own + i ) % n ];
+            std::lock_guard< std::mutex > lock( q.mutex );
+            if ( ! q.tasks.empty() )
+            {
+                    // Take the most recently submitted task from the own queue and the oldest task from other queues.
+                if ( i == 0 )
+                {
+                    t = q.tasks.back();
+                    q.tasks.pop_back();
+                }
+                else
+                {
+                    t = q.tasks.front();
+                    q.tasks.pop_front();
+                }
+                pending_.fetch_sub( 1, std::memory_order_relaxed );
+                return true;
+            }
         }
-    };
+        return false;
+    }
 
-    // this implementation detail class lets us take advantage of the
-    // empty base class optimization to pay for only storage of a single
-    // pointer in the case of fixed-size spans
-    template< class ExtentType >
-    class storage_type : public ExtentType
+    void
+    work( std::size_t own )
     {
-    public:
-        gsl_api gsl_constexpr storage_type( detail::extent_type< 0 > ext )
-            : ExtentType( ext ), data_( gsl_nullptr )
+        for ( ;; )
         {
+            task t;
+            if ( take( own, t ) )
+            {
+                t.job->execute( t.index );
+                continue;
+            }
+            std::unique_lock< std::mutex > lock( wait_mutex_ );
+            wake_.wait( lock, [ this ] { return stop_ || pending_.load( std::memory_order_relaxed ) > 0; } );
+            if ( stop_ && pending_.load( std::memory_order_relaxed ) <= 0 )
+            {
+                return;
+            }
         }
+    }
 
-        // known_not_null parameter is needed to remove unnecessary null check
-        // in subspans and constructors from arrays
-        template< class OtherExtentType >
-        gsl_api gsl_constexpr storage_type( known_not_null data, OtherExtentType ext )
-            : ExtentType( ext ), data_( data.p )
+    void
+    submit( detail::parallel_job & job, std::size_t count )
+    {
+        std::size_t const n = queues_.size();
+        std::size_t const first = next_queue_.fetch_add( 1, std::memory_order_relaxed );
+        for ( std::size_t i = 0; i != count; ++i )
         {
+            task_queue & q = *queues_[ ( first + i ) % n ];
+            std::lock_guard< std::mutex > lock( q.mutex );
+            task const t = { &job, i };
+            q.tasks.push_back( t );
         }
-
-        template< class OtherExtentType >
-        gsl_api gsl_constexpr14 storage_type( pointer data, OtherExtentType ext )
-            : ExtentType( ext ), data_( data )
+        pending_.fetch_add( static_cast< std::ptrdiff_t >( count ), std::memory_order_relaxed );
         {
-            gsl_Expects( data || ExtentType::size() == 0 );
+            std::lock_guard< std::mutex > lock( wait_mutex_ );
         }
+        wake_.notify_all();
+    }
 
-        gsl_api gsl_constexpr pointer data() const gsl_noexcept { return data_; }
-
-    private:
-        pointer data_;
-    };
-
-    storage_type< detail::extent_type< Extent > > storage_;
-
-    // The rest is needed to remove unnecessary null check
-    // in subspans and constructors from arrays
-    gsl_api gsl_constexpr span( known_not_null ptr, size_type count ) gsl_noexcept
-        : storage_(ptr, count)
+public:
+    // Creates a pool with `thread_count` worker threads. A pool without worker threads executes all tasks in the waiting thread.
+    explicit thread_pool( std::size_t thread_count )
+    : queues_(), workers_(), next_queue_( 0 ), pending_( 0 ), stop_( false )
     {
+        std::size_t const queue_count = thread_count > 0 ? thread_count : 1;
+        queues_.reserve( queue_count );
+        for ( std::size_t i = 0; i != queue_count; ++i )
+        {
+            queues_.push_back( std::unique_ptr< task_queue >( new task_queue() ) );
+        }
+        workers_.reserve( thread_count );
+        for ( std::size_t i = 0; i != thread_count; ++i )
+        {
+            workers_.push_back( std::thread( &thread_pool::work, this, i ) );
+        }
     }
-
-    template< gsl_CONFIG_SPAN_INDEX_TYPE CallerExtent >
-    class subspan_selector
+    ~thread_pool()
     {
-    };
+        {
+            std::lock_guard< std::mutex > lock( wait_mutex_ );
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for ( std::size_t i = 0; i != workers_.size(); ++i )
+        {
+            workers_[ i ].join();
+        }
+    }
 
-    template< gsl_CONFIG_SPAN_INDEX_TYPE CallerExtent >
-    gsl_api gsl_constexpr14 span< element_type, dynamic_extent >
-    make_subspan( size_type offset, size_type count, subspan_selector< CallerExtent > ) const
+gsl_is_delete_access:
+    thread_pool( thread_pool const & ) gsl_is_delete;
+    thread_pool & operator=( thread_pool const & ) gsl_is_delete;
+
+public:
+    gsl_NODISCARD std::size_t
+    thread_count() const gsl_noexcept
     {
-        span< element_type, dynamic_extent > const tmp( *this );
-        return tmp.subspan( offset, count );
+        return workers_.size();
     }
 
-    gsl_SUPPRESS_MSGSL_WARNING(bounds.1)
-    gsl_api gsl_constexpr14 span< element_type, dynamic_extent >
-    make_subspan( size_type offset, size_type count, subspan_selector< dynamic_extent > ) const
+    // Submits `count` tasks of `job` and executes tasks until no queued tasks are left, then blocks until the tasks of `job` taken
+    // by worker threads are done. Rethrows the first exception thrown by a task of `job`.
+    void
+    run( detail::parallel_job & job, std::size_t count )
     {
-        gsl_Expects( static_cast<std::size_t>( size() ) >= static_cast<std::size_t>( offset ) );
-
-        if ( count == dynamic_extent )
+        submit( job, count );
+        task t;
+        while ( take( 0, t ) )
         {
-            return span< element_type, dynamic_extent >( known_not_null( data() + offset ), size() - offset );
+            t.job->execute( t.index );
         }
-
-        gsl_Expects( static_cast<std::size_t>( size() ) - static_cast<std::size_t>( offset ) >= static_cast<std::size_t>( count ) );
-        return span< element_type, dynamic_extent >( known_not_null( data() + offset ), count );
+        job.wait();
+        job.rethrow_error();
     }
 };
 
-// class template argument deduction guides:
+// Returns a process-wide pool with one worker thread less than the number of hardware threads, the waiting thread being the last.
+inline thread_pool &
+default_thread_pool()
+{
+    static thread_pool pool( std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 0 );
+    return pool;
+}
 
-# if gsl_HAVE( DEDUCTION_GUIDES )   // gsl_CPP17_OR_GREATER
+namespace detail {
 
-template<class Type, std::size_t Extent >
-span( Type (&)[Extent] ) -> span< Type, Extent >;
+template< class T, class F >
+void
+run_partitioned( thread_pool & pool, span< T > s, partitioning const & p, F f )
+{
+    partition_job< T, F > job( s, p, f );
+    pool.run( job, p.count() );
+}
 
-template< class Type, std::size_t Size >
-span( std::array<Type, Size> & ) -> span< Type, Size >;
+} // namespace detail
 
-template< class Type, std::size_t Size >
-span( std::array<Type, Size> const & ) -> span< Type const, Size >;
+// Calls `f( part )` concurrently for partitions `part` of `s` with at least `grain` elements each. Partition boundaries are aligned
+// to cache lines if possible.
+template< class T, class F >
+void
+parallel_for( thread_pool & pool, span< T > s, std::size_t grain, F f )
+{
+    gsl_Expects( grain > 0 );
+    if ( s.empty() )
+    {
+        return;
+    }
+    detail::partitioning const p( s.data(), sizeof( T ), static_cast< std::size_t >( s.size() ), grain );
+    detail::run_partitioned( pool, s, p, [ &f ]( std::size_t, span< T > part ) { f( part ); } );
+}
+template< class T, class F >
+void
+parallel_for( span< T > s, std::size_t grain, F f )
+{
+    parallel_for( default_thread_pool(), s, grain, f );
+}
 
-template< class Container,
-          class Element = std::remove_pointer_t<decltype( std::declval< Container & >().data()) > >
-span( Container & ) -> span< Element >;
+// Computes `op( ... op( op( identity, f( part0 ) ), f( part1 ) ) ... )` for partitions `part0`, `part1`, ... of `s` with at least
+// `grain` elements each, calling `f` concurrently.
+template< class T, class R, class F, class Op >
+gsl_NODISCARD R
+parallel_reduce( thread_pool & pool, span< T > s, std::size_t grain, R identity, F f, Op op )
+{
+    gsl_Expects( grain > 0 );
+    if ( s.empty() )
+    {
+        return identity;
+    }
+    detail::partitioning const p( s.data(), sizeof( T ), static_cast< std::size_t >( s.size() ), grain );
+    std::vector< R > results( p.count(), identity );
+    R * const out = results.data();
+    detail::run_partitioned( pool, s, p, [ out, &f ]( std::size_t index, span< T > part ) { out[ index ] = f( part ); } );
+    R result = identity;
+    for ( std::size_t i = 0; i != results.size(); ++i )
+    {
+        result = op( result, results[ i ] );
+    }
+    return result;
+}
+template< class T, class R, class F, class Op >
+gsl_NODISCARD R
+parallel_reduce( span< T > s, std::size_t grain, R identity, F f, Op op )
+{
+    return parallel_reduce( default_thread_pool(), s, grain, identity, f, op );
+}
 
-template< class Container,
-          class Element = std::remove_pointer_t<decltype( std::declval< Container const & >().data()) > >
-span( Container const & ) -> span< Element >;
+#endif // gsl_FEATURE( EXPERIMENTAL_PARALLEL ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
 
-# endif // gsl_HAVE( DEDUCTION_GUIDES )
+#if gsl_FEATURE( EXPERIMENTAL_SORT ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
 
-# if ! gsl_CPP17_OR_GREATER
-#  if defined( __clang__ ) && defined( _MSC_VER )
-#   pragma clang diagnostic push
-#   pragma clang diagnostic ignored "-Wdeprecated" // Bug in clang-cl.exe which raises a C++17 -Wdeprecated warning about this static constexpr workaround in C++14 mode.
-#  endif // defined( __clang__ ) && defined( _MSC_VER )
-template< class T, gsl_CONFIG_SPAN_INDEX_TYPE Extent >
-gsl_constexpr const typename span< T, Extent >::size_type span< T, Extent >::extent;
-#  if defined( __clang__ ) && defined( _MSC_VER )
-#   pragma clang diagnostic pop
-#  endif // defined( __clang__ ) && defined( _MSC_VER )
-# endif // ! gsl_CPP17_OR_GREATER
+//
+// radix_sort(), merge_sort(), sort() - Sorting algorithms for span<> which use caller-provided scratch space instead of allocating.
+//
 
-# if gsl_COMPILER_MSVC_VER
-#  pragma warning( pop )
-# endif // gsl_COMPILER_MSVC_VER
+namespace detail {
 
-# if defined( __GNUC__ ) && __GNUC__ > 6
-#  pragma GCC diagnostic pop
-# endif // defined( __GNUC__ ) && __GNUC__ > 6
+// Maps keys to unsigned integers with the same order.
+template< class K, class Enable = void >
+struct radix_key { };
+template< class K >
+struct radix_key< K, typename std::enable_if< std::is_integral< K >::value && ! std::is_same< K, bool >::value >::type >
+{
+    typedef typename std::make_unsigned< K >::type type;
 
-# if defined( __clang__ )
-#  if __has_warning( "-Wunsafe-buffer-usage" )
-#   pragma clang diagnostic pop
-#  endif // __has_warning( "-Wunsafe-buffer-usage" )
-# endif // defined( __clang__ )
+    static type
+    get( K key ) gsl_noexcept
+    {
+            // Flip the sign bit of signed keys so that negative keys precede positive keys.
+        return std::is_signed< K >::value
+            ? static_cast< type >( static_cast< type >( key ) ^ static_cast< type >( type( 1 ) << ( std::numeric_limits< type >::digits - 1 ) ) )
+            : static_cast< type >( key );
+    }
+};
+template< class K, class U >
+struct radix_float_key
+{
+    typedef U type;
 
-// 26.7.3.7 Comparison operators [span.comparison]
+    static type
+    get( K key ) gsl_noexcept
+    {
+        type const sign = type( 1 ) << ( std::numeric_limits< type >::digits - 1 );
+        type bits;
+        std::memcpy( &bits, &key, sizeof bits );
+            // Negative keys are ordered by descending magnitude: invert all bits. Positive keys are ordered by ascending magnitude:
+            // set the sign bit so that they follow negative keys.
+        return ( bits & sign ) != 0 ? static_cast< type >( ~bits ) : static_cast< type >( bits | sign );
+    }
+};
+template<> struct radix_key< float > : radix_float_key< float, std::uint32_t > { };
+template<> struct radix_key< double > : radix_float_key< double, std::uint64_t > { };
 
-# if gsl_CONFIG( ALLOWS_SPAN_COMPARISON )
-#  if gsl_CONFIG( ALLOWS_NONSTRICT_SPAN_COMPARISON )
+template< class K, class Enable = void >
+struct is_radix_key : std::false_type { };
+template< class K >
+struct is_radix_key< K, typename std::enable_if< ( sizeof( typename radix_key< K >::type ) == sizeof( K ) ) >::type > : std::true_type { };
 
-template< class T, class U, gsl_CONFIG_SPAN_INDEX_TYPE LExtent, gsl_CONFIG_SPAN_INDEX_TYPE RExtent >
-gsl_SUPPRESS_MSGSL_WARNING(stl.1)
-gsl_NODISCARD inline gsl_constexpr bool operator==( span<T, LExtent> const & l, span<U, RExtent> const & r )
+struct identity_key
 {
-    gsl_STATIC_ASSERT_( LExtent == RExtent || LExtent == dynamic_extent || RExtent == dynamic_extent, "comparing spans of mismatching sizes" );
-    return  l.size()  == r.size()
-        && ( l.data() == r.data() || detail::equal( l.begin(), l.end(), r.begin() ) );
-}
+    template< class T >
+    T const &
+    operator()( T const & value ) const gsl_noexcept
+    {
+        return value;
+    }
+};
 
-template< class T, class U, gsl_CONFIG_SPAN_INDEX_TYPE LExtent, gsl_CONFIG_SPAN_INDEX_TYPE RExtent >
-gsl_SUPPRESS_MSGSL_WARNING(stl.1)
-gsl_NODISCARD inline gsl_constexpr bool operator< ( span<T, LExtent> const & l, span<U, RExtent> const & r )
+template< class T, class KeyFn >
+void
+radix_sort( T * data, T * scratch, std::size_t n, KeyFn & key )
 {
-    return detail::lexicographical_compare( l.begin(), l.end(), r.begin(), r.end() );
-}
-
-#  else // a.k.a. !gsl_CONFIG( ALLOWS_NONSTRICT_SPAN_COMPARISON )
+    typedef typename std::decay< decltype( key( *data ) ) >::type K;
+    typedef typename radix_key< K >::type U;
+    std::size_t const digits = sizeof( U );
 
-template< class T, gsl_CONFIG_SPAN_INDEX_TYPE LExtent, gsl_CONFIG_SPAN_INDEX_TYPE RExtent >
-gsl_SUPPRESS_MSGSL_WARNING(stl.1)
-gsl_NODISCARD inline gsl_constexpr bool operator==( span<T, LExtent> const & l, span<T, RExtent> const & r )
-{
-    gsl_STATIC_ASSERT_( LExtent == RExtent || LExtent == dynamic_extent || RExtent == dynamic_extent, "comparing spans of mismatching sizes" );
-    return  l.size()  == r.size()
-        && ( l.data() == r.data() || detail::equal( l.begin(), l.end(), r.begin() ) );
-}
+        // Count the occurrences of all digits in a single pass.
+    std::size_t counts[ sizeof( U ) ][ 256 ] = { };
+    for ( std::size_t i = 0; i != n; ++i )
+    {
+        U const k = radix_key< K >::get( key( data[ i ] ) );
+        for ( std::size_t d = 0; d != digits; ++d )
+        {
+            ++counts[ d ][ ( k >> ( 8 * d ) ) & 0xff ];
+        }
+    }
 
-template< class T, gsl_CONFIG_SPAN_INDEX_TYPE LExtent, gsl_CONFIG_SPAN_INDEX_TYPE RExtent >
-gsl_SUPPRESS_MSGSL_WARNING(stl.1)
-gsl_NODISCARD inline gsl_constexpr bool operator< ( span<T, LExtent> const & l, span<T, RExtent> const & r )
-{
-    return detail::lexicographical_compare( l.begin(), l.end(), r.begin(), r.end() );
+    T * src = data;
+    T * dst = scratch;
+    for ( std::size_t d = 0; d != digits; ++d )
+    {
+            // Skip digits which are equal for all elements.
+        if ( counts[ d ][ ( radix_key< K >::get( key( src[ 0 ] ) ) >> ( 8 * d ) ) & 0xff ] == n )
+        {
+            continue;
+        }
+        std::size_t offsets[ 256 ];
+        std::size_t offset = 0;
+        for ( std::size_t b = 0; b != 256; ++b )
+        {
+            offsets[ b ] = offset;
+            offset += counts[ d ][ b ];
+        }
+        for ( std::size_t i = 0; i != n; ++i )
+        {
+            std::size_t const b = ( radix_key< K >::get( key( src[ i ] ) ) >> ( 8 * d ) ) & 0xff;
+            dst[ offsets[ b ]++ ] = std::move( src[ i ] );
+        }
+        std::swap( src, dst );
+    }
+    if ( src != data )
+    {
+        std::move( src, src + n, data );
+    }
 }
-#  endif // gsl_CONFIG( ALLOWS_NONSTRICT_SPAN_COMPARISON )
 
-template< class T, class U, gsl_CONFIG_SPAN_INDEX_TYPE LExtent, gsl_CONFIG_SPAN_INDEX_TYPE RExtent >
-gsl_NODISCARD inline gsl_constexpr bool
-operator!=( span<T, LExtent> const & l, span<U, RExtent> const & r )
+template< class T, class Compare >
+void
+insertion_sort( T * first, T * last, Compare & comp )
 {
-    return !( l == r );
+    for ( T * i = first; i != last; ++i )
+    {
+        T * j = i;
+        if ( j != first && comp( *j, *( j - 1 ) ) )
+        {
+            T value = std::move( *j );
+            do
+            {
+                *j = std::move( *( j - 1 ) );
+                --j;
+            } while ( j != first && comp( value, *( j - 1 ) ) );
+            *j = std::move( value );
+        }
+    }
 }
 
-template< class T, class U, gsl_CONFIG_SPAN_INDEX_TYPE LExtent, gsl_CONFIG_SPAN_INDEX_TYPE RExtent >
-gsl_NODISCARD inline gsl_constexpr bool
-operator<=( span<T, LExtent> const & l, span<U, RExtent> const & r )
+// Merges the adjacent sorted ranges [first, middle) and [middle, last) of `src` into `dst`.
+template< class T, class Compare >
+void
+merge( T * src, std::size_t first, std::size_t middle, std::size_t last, T * dst, Compare & comp )
 {
-    return !( r < l );
+    std::merge( std::make_move_iterator( src + first ), std::make_move_iterator( src + middle ),
+                std::make_move_iterator( src + middle ), std::make_move_iterator( src + last ),
+                dst + first, std::ref( comp ) );
 }
 
-template< class T, class U, gsl_CONFIG_SPAN_INDEX_TYPE LExtent, gsl_CONFIG_SPAN_INDEX_TYPE RExtent >
-gsl_NODISCARD inline gsl_constexpr bool
-operator>( span<T, LExtent> const & l, span<U, RExtent> const & r )
+template< class T, class Compare >
+void
+merge_sort( T * data, T * scratch, std::size_t n, Compare & comp )
 {
-    return ( r < l );
+    std::size_t const run = 32;
+    for ( std::size_t first = 0; first < n; first += run )
+    {
+        insertion_sort( data + first, data + ( n - first < run ? n : first + run ), comp );
+    }
+    T * src = data;
+    T * dst = scratch;
+    for ( std::size_t width = run; width < n; width *= 2 )
+    {
+        for ( std::size_t first = 0; first < n; first += 2 * width )
+        {
+            std::size_t const middle = n - first < width ? n : first + width;
+            std::size_t const last = n - middle < width ? n : middle + width;
+            detail::merge( src, first, middle, last, dst, comp );
+        }
+        std::swap( src, dst );
+    }
+    if ( src != data )
+    {
+        std::move( src, src + n, data );
+    }
 }
 
-template< class T, class U, gsl_CONFIG_SPAN_INDEX_TYPE LExtent, gsl_CONFIG_SPAN_INDEX_TYPE RExtent >
-gsl_NODISCARD inline gsl_constexpr bool
-operator>=( span<T, LExtent> const & l, span<U, RExtent> const & r )
+} // namespace detail
+
+// Sorts `s` with a stable LSD radix sort, ordering the elements by the integral or floating-point key `key( element )`. Negative
+// keys precede positive keys. `scratch` must have at least as many elements as `s`; its elements are left in an unspecified state.
+template< class T, class KeyFn >
+void
+radix_sort( span< T > s, span< T > scratch, KeyFn key )
 {
-    return !( l < r );
+    gsl_Expects( scratch.size() >= s.size() );
+    if ( s.size() > 1 )
+    {
+        detail::radix_sort( s.data(), scratch.data(), static_cast< std::size_t >( s.size() ), key );
+    }
 }
-# endif // gsl_CONFIG( ALLOWS_SPAN_COMPARISON )
-
-// span algorithms
-
-template< class T, gsl_CONFIG_SPAN_INDEX_TYPE Extent >
-gsl_NODISCARD gsl_api inline gsl_constexpr std::size_t
-size( span<T, Extent> const & spn )
+template< class T
+    gsl_ENABLE_IF_(( detail::is_radix_key< T >::value ))
+>
+void
+radix_sort( span< T > s, span< T > scratch )
 {
-    return static_cast<std::size_t>( spn.size() );
+    gsl_lite::radix_sort( s, scratch, detail::identity_key() );
 }
 
-template< class T, gsl_CONFIG_SPAN_INDEX_TYPE Extent >
-gsl_NODISCARD gsl_api inline gsl_constexpr std::ptrdiff_t
-ssize( span<T, Extent> const & spn )
+// Sorts `s` with a stable merge sort. `scratch` must have at least as many elements as `s`; its elements are left in an
+// unspecified state.
+template< class T, class Compare >
+void
+merge_sort( span< T > s, span< T > scratch, Compare comp )
 {
-    return spn.ssize();
+    gsl_Expects( scratch.size() >= s.size() );
+    detail::merge_sort( s.data(), scratch.data(), static_cast< std::size_t >( s.size() ), comp );
+}
+template< class T >
+void
+merge_sort( span< T > s, span< T > scratch )
+{
+    gsl_lite::merge_sort( s, scratch, std::less< T >() );
 }
 
+# if gsl_FEATURE( EXPERIMENTAL_PARALLEL )
+
 namespace detail {
 
-template< class II, class N, class OI >
-gsl_api gsl_constexpr14 inline OI copy_n( II first, N count, OI result )
+// Sorts `parts` chunks of the data concurrently if `width` is 0, or otherwise merges pairs of adjacent sorted sequences of `width`
+// chunks each from `src` into `dst`.
+template< class T, class Compare >
+class merge_sort_job : public parallel_job
 {
-    if ( count > 0 )
+private:
+    T * src_;
+    T * dst_;
+    std::size_t n_;
+    std::size_t parts_;
+    std::size_t width_;
+    Compare & comp_;
+
+    std::size_t
+    bound( std::size_t part ) const gsl_noexcept
     {
-        *result++ = *first;
-        for ( N i = 1; i < count; ++i )
+        return n_ / parts_ * part + n_ % parts_ * part / parts_;
+    }
+
+    void
+    run( std::size_t index ) override
+    {
+        if ( width_ == 0 )
         {
-            *result++ = *++first;
+            std::size_t const first = bound( index );
+            detail::merge_sort( src_ + first, dst_ + first, bound( index + 1 ) - first, comp_ );
+        }
+        else
+        {
+            std::size_t const part = 2 * width_ * index;
+            detail::merge( src_, bound( part ), bound( part + width_ ), bound( part + 2 * width_ ), dst_, comp_ );
         }
     }
-    return result;
-}
+
+public:
+    merge_sort_job( std::size_t count, T * src, T * dst, std::size_t n, std::size_t parts, std::size_t width, Compare & comp ) gsl_noexcept
+    : parallel_job( count ), src_( src ), dst_( dst ), n_( n ), parts_( parts ), width_( width ), comp_( comp )
+    {
+    }
+};
 
 } // namespace detail
 
-template< class T, class U, gsl_CONFIG_SPAN_INDEX_TYPE LExtent, gsl_CONFIG_SPAN_INDEX_TYPE RExtent >
-gsl_api gsl_constexpr14 inline void copy( span<T, LExtent> src, span<U, RExtent> dest )
+// Sorts `s` with a stable merge sort, sorting and merging chunks concurrently on `pool`. `scratch` must have at least as many
+// elements as `s`; its elements are left in an unspecified state.
+template< class T, class Compare >
+void
+merge_sort( thread_pool & pool, span< T > s, span< T > scratch, Compare comp )
 {
-# if gsl_CPP14_OR_GREATER // gsl_HAVE( TYPE_TRAITS ) (circumvent Travis clang 3.4)
-    static_assert( std::is_assignable<U &, T const &>::value, "Cannot assign elements of source span to elements of destination span" );
-# endif
-    gsl_STATIC_ASSERT_( RExtent >= LExtent || LExtent == dynamic_extent || RExtent == dynamic_extent ,"incompatible span extents" );
-    gsl_Expects( dest.size() >= src.size() );
-    detail::copy_n( src.data(), src.size(), dest.data() );
-}
-
-# if gsl_FEATURE( BYTE )
-// span creator functions (see ctors)
+    gsl_Expects( scratch.size() >= s.size() );
+    std::size_t const n = static_cast< std::size_t >( s.size() );
+    std::size_t const min_chunk = 4096;
+    std::size_t const threads = pool.thread_count() + 1;
+    std::size_t parts = 1;
+    while ( parts < 4 * threads && n / ( 2 * parts ) >= min_chunk )
+    {
+        parts *= 2;
+    }
+    if ( parts == 1 )
+    {
+        detail::merge_sort( s.data(), scratch.data(), n, comp );
+        return;
+    }
 
-template< class T, gsl_CONFIG_SPAN_INDEX_TYPE Extent >
-gsl_NODISCARD gsl_api inline span< const byte >
-as_bytes( span< T, Extent > spn ) gsl_noexcept
+    T * src = s.data();
+    T * dst = scratch.data();
+    {
+        detail::merge_sort_job< T, Compare > job( parts, src, dst, n, parts, 0, comp );
+        pool.run( job, parts );
+    }
+    for ( std::size_t width = 1; width < parts; width *= 2 )
+    {
+        detail::merge_sort_job< T, Compare > job( parts / ( 2 * width ), src, dst, n, parts, width, comp );
+        pool.run( job, parts / ( 2 * width ) );
+        std::swap( src, dst );
+    }
+    if ( src != s.data() )
+    {
+        std::move( src, src + n, s.data() );
+    }
+}
+template< class T >
+void
+merge_sort( thread_pool & pool, span< T > s, span< T > scratch )
 {
-    return span< const byte >( reinterpret_cast<const byte *>( spn.data() ), spn.size_bytes() ); // NOLINT
+    gsl_lite::merge_sort( pool, s, scratch, std::less< T >() );
 }
 
-template< class T, gsl_CONFIG_SPAN_INDEX_TYPE Extent >
-gsl_NODISCARD gsl_api inline span< byte >
-as_writable_bytes( span< T, Extent > spn ) gsl_noexcept
+# endif // gsl_FEATURE( EXPERIMENTAL_PARALLEL )
+
+// Sorts `s` with `comp`, using `merge_sort()` on the default thread pool if parallel algorithms are enabled.
+template< class T, class Compare >
+void
+sort( span< T > s, span< T > scratch, Compare comp )
 {
-    return span< byte >( reinterpret_cast<byte *>( spn.data() ), spn.size_bytes() ); // NOLINT
+# if gsl_FEATURE( EXPERIMENTAL_PARALLEL )
+    gsl_lite::merge_sort( default_thread_pool(), s, scratch, comp );
+# else
+    gsl_lite::merge_sort( s, scratch, comp );
+# endif
 }
-# endif // gsl_FEATURE( BYTE )
 
-# if gsl_FEATURE_TO_STD( MAKE_SPAN )
+namespace detail {
 
 template< class T >
-gsl_NODISCARD gsl_api inline gsl_constexpr span<T>
-make_span( T * ptr, typename span<T>::index_type count )
+void
+sort( span< T > s, span< T > scratch, std::true_type /*isRadixKey*/ )
 {
-    return span<T>( ptr, count );
+    gsl_lite::radix_sort( s, scratch );
+}
+template< class T >
+void
+sort( span< T > s, span< T > scratch, std::false_type /*isRadixKey*/ )
+{
+    gsl_lite::sort( s, scratch, std::less< T >() );
 }
 
+} // namespace detail
+
+// Sorts `s` in ascending order, using `radix_sort()` for integral and floating-point elements and `merge_sort()` otherwise.
 template< class T >
-gsl_NODISCARD gsl_api inline gsl_constexpr span<T>
-make_span( T * first, T * last )
+void
+sort( span< T > s, span< T > scratch )
 {
-    return span<T>( first, last );
+    detail::sort( s, scratch, detail::is_radix_key< T >() );
 }
 
-template< class T, std::size_t N >
-gsl_NODISCARD inline gsl_constexpr span<T, static_cast<gsl_CONFIG_SPAN_INDEX_TYPE>( N )>
-make_span( T (&arr)[N] )
+#endif // gsl_FEATURE( EXPERIMENTAL_SORT ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+
+#if gsl_FEATURE( EXPERIMENTAL_NUMERIC ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+
+//
+// inclusive_scan(), exclusive_scan(), reduce(), minmax() - Prefix sums and reductions over span<>.
+//
+// The loops are written such that compilers can vectorize them. The `_failfast` variants accumulate integers in the widest integer
+// type of the same signedness and raise an assertion failure, as `narrow_failfast<>()` does, if a sum is not representable.
+
+namespace detail {
+
+template< class U >
+struct wide_accumulator
 {
-    return span<T, static_cast<gsl_CONFIG_SPAN_INDEX_TYPE>( N )>( arr );
+    typedef typename std::conditional< std::is_signed< U >::value, long long, unsigned long long >::type type;
+};
+
+template< class A >
+A
+add_failfast( A acc, A x, std::true_type /*isSigned*/ )
+{
+    gsl_Assert( x < 0 ? acc >= ( std::numeric_limits< A >::min )() - x : acc <= ( std::numeric_limits< A >::max )() - x );
+    return acc + x;
+}
+template< class A >
+A
+add_failfast( A acc, A x, std::false_type /*isSigned*/ )
+{
+    gsl_Assert( acc <= ( std::numeric_limits< A >::max )() - x );
+    return acc + x;
+}
+template< class A >
+A
+add_failfast( A acc, A x )
+{
+    return detail::add_failfast( acc, x, std::is_signed< A >() );
 }
 
-#  if gsl_HAVE( ARRAY )
+template< class T, class U >
+U
+scan( T const * in, U * out, std::size_t n, U acc, bool inclusive ) gsl_noexcept
+{
+    if ( inclusive )
+    {
+        for ( std::size_t i = 0; i != n; ++i )
+        {
+            acc += in[ i ];
+            out[ i ] = acc;
+        }
+    }
+    else
+    {
+        for ( std::size_t i = 0; i != n; ++i )
+        {
+            U const x = static_cast< U >( in[ i ] );
+            out[ i ] = acc;
+            acc += x;
+        }
+    }
+    return acc;
+}
 
-template< class T, std::size_t N >
-gsl_NODISCARD inline gsl_constexpr span<T, static_cast<gsl_CONFIG_SPAN_INDEX_TYPE>( N )>
-make_span( std::array<T, N> & arr )
+template< class T, class U >
+U
+scan_failfast( T const * in, U * out, std::size_t n, U init, bool inclusive )
 {
-    return span<T, static_cast<gsl_CONFIG_SPAN_INDEX_TYPE>( N )>( arr );
+    typedef typename wide_accumulator< U >::type A;
+    A acc = narrow_failfast< A >( init );
+    for ( std::size_t i = 0; i != n; ++i )
+    {
+        A const x = narrow_failfast< A >( in[ i ] );
+        if ( ! inclusive )
+        {
+            out[ i ] = narrow_failfast< U >( acc );
+        }
+        acc = detail::add_failfast( acc, x );
+        if ( inclusive )
+        {
+            out[ i ] = narrow_failfast< U >( acc );
+        }
+    }
+    return narrow_failfast< U >( acc );
 }
 
-template< class T, std::size_t N >
-gsl_NODISCARD inline gsl_constexpr span<const T, static_cast<gsl_CONFIG_SPAN_INDEX_TYPE>( N )>
-make_span( std::array<T, N> const & arr )
+template< class T, class R >
+R
+reduce( T const * data, std::size_t n, R init ) gsl_noexcept
 {
-    return span<const T, static_cast<gsl_CONFIG_SPAN_INDEX_TYPE>( N )>( arr );
+        // Independent accumulators break the dependency chain between consecutive additions.
+    R acc0 = init, acc1 = R(), acc2 = R(), acc3 = R();
+    std::size_t i = 0;
+    for ( ; n - i >= 4; i += 4 )
+    {
+        acc0 += data[ i ];
+        acc1 += data[ i + 1 ];
+        acc2 += data[ i + 2 ];
+        acc3 += data[ i + 3 ];
+    }
+    for ( ; i != n; ++i )
+    {
+        acc0 += data[ i ];
+    }
+    return static_cast< R >( ( acc0 + acc1 ) + ( acc2 + acc3 ) );
 }
-#  endif
 
-# if gsl_HAVE( CONSTRAINED_SPAN_CONTAINER_CTOR ) && gsl_HAVE( AUTO )
+} // namespace detail
 
-template< class Container, class EP = decltype( std17::data(std::declval<Container&>())) >
-gsl_NODISCARD inline gsl_constexpr auto
-make_span( Container & cont ) -> span< typename std::remove_pointer<EP>::type >
+// Writes the prefix sums `in[0]`, `in[0] + in[1]`, ... to `out`, which may be `in`, and returns the sum of all elements. The sums
+// are computed with the element type of `out`.
+template< class T, class U >
+U
+inclusive_scan( span< T > in, span< U > out )
 {
-    return span< typename std::remove_pointer<EP>::type >( cont );
+    gsl_Expects( out.size() == in.size() );
+    return detail::scan( in.data(), out.data(), static_cast< std::size_t >( in.size() ), U(), true );
 }
 
-template< class Container, class EP = decltype( std17::data(std::declval<Container&>())) >
-gsl_NODISCARD inline gsl_constexpr auto
-make_span( Container const & cont ) -> span< const typename std::remove_pointer<EP>::type >
+// Writes the prefix sums `init`, `init + in[0]`, ... to `out`, which may be `in`, and returns `init` plus the sum of all elements.
+// The sums are computed with the element type of `out`.
+template< class T, class U >
+U
+exclusive_scan( span< T > in, span< U > out, U init )
 {
-    return span< const typename std::remove_pointer<EP>::type >( cont );
+    gsl_Expects( out.size() == in.size() );
+    return detail::scan( in.data(), out.data(), static_cast< std::size_t >( in.size() ), init, false );
+}
+template< class T, class U >
+U
+exclusive_scan( span< T > in, span< U > out )
+{
+    return gsl_lite::exclusive_scan( in, out, U() );
 }
 
-#  else
+// Like `inclusive_scan()`, but raises an assertion failure if an element or a prefix sum is not representable in `U`.
+template< class T, class U
+    gsl_ENABLE_IF_(( std::is_integral< U >::value ))
+>
+U
+inclusive_scan_failfast( span< T > in, span< U > out )
+{
+    gsl_Expects( out.size() == in.size() );
+    return detail::scan_failfast( in.data(), out.data(), static_cast< std::size_t >( in.size() ), U(), true );
+}
 
-template< class T >
-inline span<T>
-make_span( std::vector<T> & cont )
+// Like `exclusive_scan()`, but raises an assertion failure if an element or a prefix sum is not representable in `U`.
+template< class T, class U
+    gsl_ENABLE_IF_(( std::is_integral< U >::value ))
+>
+U
+exclusive_scan_failfast( span< T > in, span< U > out, U init = U() )
 {
-    return span<T>( cont.data(), cont.data() + cont.size() );
+    gsl_Expects( out.size() == in.size() );
+    return detail::scan_failfast( in.data(), out.data(), static_cast< std::size_t >( in.size() ), init, false );
 }
 
+// Returns `init` plus the sum of all elements, computed with type `R`. The order of the additions is unspecified.
+template< class T, class R >
+gsl_NODISCARD R
+reduce( span< T > s, R init )
+{
+    return detail::reduce( s.data(), static_cast< std::size_t >( s.size() ), init );
+}
 template< class T >
-inline span<const T>
-make_span( std::vector<T> const & cont )
+gsl_NODISCARD typename std::remove_cv< T >::type
+reduce( span< T > s )
 {
-    return span<const T>( cont.data(), cont.data() + cont.size() );
+    return gsl_lite::reduce( s, typename std::remove_cv< T >::type() );
 }
 
-#  endif
-
-#  if gsl_FEATURE_TO_STD( WITH_CONTAINER )
-
-template< class Container >
-gsl_NODISCARD inline gsl_constexpr span<typename Container::value_type>
-make_span( with_container_t, Container & cont ) gsl_noexcept
+// Like `reduce()`, but raises an assertion failure if an element or the sum is not representable in `R`.
+template< class T, class R
+    gsl_ENABLE_IF_(( std::is_integral< R >::value ))
+>
+gsl_NODISCARD R
+reduce_failfast( span< T > s, R init )
 {
-    return span< typename Container::value_type >( with_container, cont );
+    typedef typename detail::wide_accumulator< R >::type A;
+    A acc = narrow_failfast< A >( init );
+    for ( std::size_t i = 0, n = static_cast< std::size_t >( s.size() ); i != n; ++i )
+    {
+        acc = detail::add_failfast( acc, narrow_failfast< A >( s.data()[ i ] ) );
+    }
+    return narrow_failfast< R >( acc );
 }
 
-template< class Container >
-gsl_NODISCARD inline gsl_constexpr span<const typename Container::value_type>
-make_span( with_container_t, Container const & cont ) gsl_noexcept
+// Returns the smallest and the largest element of the non-empty span `s`.
+template< class T >
+gsl_NODISCARD std::pair< typename std::remove_cv< T >::type, typename std::remove_cv< T >::type >
+minmax( span< T > s )
 {
-    return span< const typename Container::value_type >( with_container, cont );
+    typedef typename std::remove_cv< T >::type V;
+    gsl_Expects( ! s.empty() );
+    T * const data = s.data();
+    V lo = data[ 0 ];
+    V hi = data[ 0 ];
+    for ( std::size_t i = 1, n = static_cast< std::size_t >( s.size() ); i != n; ++i )
+    {
+        V const x = data[ i ];
+        lo = x < lo ? x : lo;
+        hi = hi < x ? x : hi;
+    }
+    return std::pair< V, V >( lo, hi );
 }
 
-#  endif // gsl_FEATURE_TO_STD( WITH_CONTAINER )
-# endif // gsl_FEATURE_TO_STD( MAKE_SPAN )
+# if gsl_FEATURE( EXPERIMENTAL_PARALLEL )
 
-# if gsl_FEATURE( BYTE ) && gsl_FEATURE_TO_STD( BYTE_SPAN )
+namespace detail {
 
-template< class T >
-gsl_NODISCARD gsl_api inline gsl_constexpr span<byte>
-byte_span( T & t ) gsl_noexcept
+// Two-pass parallel scan: the first pass sums the elements of each partition, the second pass scans each partition starting with
+// the sum of all preceding partitions.
+template< class T, class U >
+U
+parallel_scan( thread_pool & pool, span< T > in, span< U > out, std::size_t grain, U init, bool inclusive )
 {
-    return span<byte>( reinterpret_cast<byte *>( &t ), sizeof(T) );
+    gsl_Expects( out.size() == in.size() );
+    gsl_Expects( grain > 0 );
+    if ( in.empty() )
+    {
+        return init;
+    }
+    partitioning const p( out.data(), sizeof( U ), static_cast< std::size_t >( out.size() ), grain );
+    std::vector< U > offsets( p.count(), U() );
+    U * const sums = offsets.data();
+    T * const first = in.data();
+    U * const out_first = out.data();
+    detail::run_partitioned( pool, out, p, [ sums, first, out_first ]( std::size_t index, span< U > part )
+    {
+        sums[ index ] = detail::reduce( first + ( part.data() - out_first ), static_cast< std::size_t >( part.size() ), U() );
+    } );
+    U acc = init;
+    for ( std::size_t i = 0; i != offsets.size(); ++i )
+    {
+        U const sum = offsets[ i ];
+        offsets[ i ] = acc;
+        acc += sum;
+    }
+    detail::run_partitioned( pool, out, p, [ sums, first, out_first, inclusive ]( std::size_t index, span< U > part )
+    {
+        detail::scan( first + ( part.data() - out_first ), part.data(), static_cast< std::size_t >( part.size() ), sums[ index ], inclusive );
+    } );
+    return acc;
 }
 
-template< class T >
-gsl_NODISCARD gsl_api inline gsl_constexpr span<const byte>
-byte_span( T const & t ) gsl_noexcept
+} // namespace detail
+
+// Like `inclusive_scan()`, but scans partitions of at least `grain` elements concurrently on `pool`.
+template< class T, class U >
+U
+inclusive_scan( thread_pool & pool, span< T > in, span< U > out, std::size_t grain )
 {
-    return span<const byte>( reinterpret_cast<byte const *>( &t ), sizeof(T) );
+    return detail::parallel_scan( pool, in, out, grain, U(), true );
 }
 
-# endif // gsl_FEATURE( BYTE ) && gsl_FEATURE_TO_STD( BYTE_SPAN )
-#endif // gsl_FEATURE( SPAN )
+// Like `exclusive_scan()`, but scans partitions of at least `grain` elements concurrently on `pool`.
+template< class T, class U >
+U
+exclusive_scan( thread_pool & pool, span< T > in, span< U > out, std::size_t grain, U init = U() )
+{
+    return detail::parallel_scan( pool, in, out, grain, init, false );
+}
+
+# endif // gsl_FEATURE( EXPERIMENTAL_PARALLEL )
+
+#endif // gsl_FEATURE( EXPERIMENTAL_NUMERIC ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
 
 #if gsl_FEATURE( STRING_SPAN )
 //
@@ -7050,6 +12992,28 @@ public:
         return hash<T*>()( ::gsl_lite::as_nullable( v ) );
     }
 };
+template< class T >
+struct hash< ::gsl_lite::optional_not_null< T > > : public ::gsl_lite::detail::conditionally_enabled_hash< is_default_constructible< hash< T > >::value >
+{
+public:
+    gsl_NODISCARD std::size_t
+    operator()( ::gsl_lite::optional_not_null<T> const & v ) const
+    {
+        return hash<T>()( ::gsl_lite::as_nullable( v ) );
+    }
+};
+# if gsl_FEATURE( EXPERIMENTAL_INTRUSIVE_PTR ) && gsl_STDLIB_CPP11_OR_GREATER
+template< class T >
+struct hash< ::gsl_lite::intrusive_ptr< T > >
+{
+public:
+    gsl_NODISCARD std::size_t
+    operator()( ::gsl_lite::intrusive_ptr< T > const & v ) const gsl_noexcept
+    {
+        return hash<T*>()( v.get() );
+    }
+};
+# endif // gsl_FEATURE( EXPERIMENTAL_INTRUSIVE_PTR ) && gsl_STDLIB_CPP11_OR_GREATER
 
 # if gsl_FEATURE( BYTE )
 template<>
@@ -7121,6 +13085,13 @@ gsl_RESTORE_MSVC_WARNINGS()
 #undef gsl_TRAILING_RETURN_TYPE_
 #undef gsl_TRAILING_RETURN_TYPE_2_
 #undef gsl_RETURN_DECLTYPE_
+#undef gsl_WRITES_TO_STDERR_
+#undef gsl_CONTRACT_CHECKING_LEVEL_
+#undef gsl_CONTRACT_VIOLATION_HANDLER_
+#undef gsl_CONTRACT_ASSUMES_UNENFORCED_
+#undef gsl_ADDRESS_SANITIZER_
+#undef gsl_POISON_MEMORY_REGION_
+#undef gsl_UNPOISON_MEMORY_REGION_
 #undef gsl_BASELINE_CPP20_
 
 #endif // GSL_LITE_GSL_LITE_HPP_INCLUDED
@@ -34,6 +34,20 @@ bool expectsAudit( bool x ) { gsl_ExpectsAudit( x ); return x; }
 bool ensuresAudit( bool x ) { gsl_EnsuresAudit( x ); return x; }
 bool assertAudit( bool x ) { gsl_AssertAudit( x ); return x; }
 
+bool isPositive( int x ) { return x > 0; }
+std::vector<int> const & expectsAll( std::vector<int> const & v ) { gsl_ExpectsAll( v, isPositive ); return v; }
+std::vector<int> const & ensuresAll( std::vector<int> const & v ) { gsl_EnsuresAll( v, isPositive ); return v; }
+std::vector<int> const & assertAll( std::vector<int> const & v ) { gsl_AssertAll( v, isPositive ); return v; }
+std::vector<int> const & expectsAllDebug( std::vector<int> const & v ) { gsl_ExpectsAllDebug( v, isPositive ); return v; }
+std::vector<int> const & expectsAllAudit( std::vector<int> const & v ) { gsl_ExpectsAllAudit( v, isPositive ); return v; }
+
+struct CountingIsPositive
+{
+    int * count;
+    explicit CountingIsPositive( int & count_ ) : count( &count_ ) { }
+    bool operator()( int x ) const { ++*count; return x > 0; }
+};
+
 #ifdef __cpp_lib_source_location
 bool assertAt( bool x, std::source_location const & loc = std::source_location::current() ) { gsl_AssertAt( loc, x ); return x; }
 bool verifyAt( bool x, std::source_location const & loc = std::source_location::current() ) { return gsl_VerifyAt( loc, x ); }
@@ -78,6 +92,21 @@ std::string colorToStringAt( Color color, std::source_location const & loc = std
 }
 #endif
 
+struct DefaultTag;
+struct UncheckedTag;
+struct AuditTag;
+struct LoggingTag;
+
+struct ContractViolationLog
+{
+    static int count;
+    static char const * expression;
+    static char const * message;
+};
+int ContractViolationLog::count = 0;
+char const * ContractViolationLog::expression = "";
+char const * ContractViolationLog::message = "";
+
 struct ConvertibleToBool
 {
 #if gsl_CPP11_OR_GREATER
@@ -87,6 +116,47 @@ struct ConvertibleToBool
 };
 
 
+} // anonymous namespace
+
+namespace gsl_lite {
+
+template< >
+struct contract_traits< DefaultTag > : default_contract_traits
+{
+};
+
+template< >
+struct contract_traits< UncheckedTag > : basic_contract_traits< contract_checking_level::off, false, contract_violation_traps >
+{
+};
+
+template< >
+struct contract_traits< AuditTag > : default_contract_traits
+{
+    static const int checking_level = contract_checking_level::audit;
+};
+
+template< >
+struct contract_traits< LoggingTag > : basic_contract_traits< contract_checking_level::debug, false, contract_violation_terminates >
+{
+    static void handle_violation( char const * expression, char const * message, char const *, unsigned )
+    {
+        ++ContractViolationLog::count;
+        ContractViolationLog::expression = expression;
+        ContractViolationLog::message = message;
+    }
+};
+
+} // namespace gsl_lite
+
+namespace {
+
+bool expectsDefaultTag( bool x ) { gsl_ExpectsTagged( DefaultTag, x ); return x; }
+bool expectsUncheckedTag( bool x ) { gsl_ExpectsTagged( UncheckedTag, x ); return x; }
+bool expectsAuditTag( bool x ) { gsl_ExpectsTaggedAudit( AuditTag, x ); return x; }
+bool ensuresLoggingTag( bool x ) { gsl_EnsuresTagged( LoggingTag, x ); return x; }
+bool assertDebugLoggingTag( bool x ) { gsl_AssertTaggedDebug( LoggingTag, x ); return x; }
+
 } // anonymous namespace
 
 #ifdef __cpp_lib_source_location
@@ -325,6 +395,110 @@ CASE( "gsl_AssertAudit(): Terminates on a false expression in AUDIT mode" )
 #endif
 }
 
+CASE( "all_of(): Checks whether a predicate holds for all elements of a range" )
+{
+    int a[] = { 1, 2, 3 };
+    int b[] = { 1, -2, 3 };
+    std::vector<int> va( a, a + 3 );
+    std::vector<int> vb( b, b + 3 );
+    std::vector<int> empty;
+
+    EXPECT(  gsl_lite::all_of( a, isPositive ) );
+    EXPECT( !gsl_lite::all_of( b, isPositive ) );
+    EXPECT(  gsl_lite::all_of( va, isPositive ) );
+    EXPECT( !gsl_lite::all_of( vb, isPositive ) );
+    EXPECT(  gsl_lite::all_of( empty, isPositive ) );
+#if gsl_FEATURE( SPAN )
+    EXPECT(  gsl_lite::all_of( gsl_lite::make_span( a ), isPositive ) );
+    EXPECT( !gsl_lite::all_of( gsl_lite::make_span( b ), isPositive ) );
+#endif
+}
+
+CASE( "gsl_ExpectsAll(), gsl_EnsuresAll(), gsl_AssertAll(): Allow a range satisfying the predicate" )
+{
+    int a[] = { 1, 2, 3 };
+    std::vector<int> v( a, a + 3 );
+
+    EXPECT_NO_THROW( expectsAll( v ) );
+    EXPECT_NO_THROW( ensuresAll( v ) );
+    EXPECT_NO_THROW( assertAll( v ) );
+    EXPECT_NO_THROW( expectsAll( std::vector<int>() ) );
+}
+
+CASE( "gsl_ExpectsAll(): Evaluates the predicate once per element" )
+{
+    int a[] = { 1, 2, 3 };
+    std::vector<int> v( a, a + 3 );
+    int count = 0;
+
+    gsl_ExpectsAll( v, CountingIsPositive( count ) );
+
+    EXPECT( count == 3 );
+}
+
+CASE( "gsl_ExpectsAll(), gsl_EnsuresAll(), gsl_AssertAll(): Terminate on a range with an element violating the predicate" )
+{
+    int a[] = { 1, 2, 0 };
+    std::vector<int> v( a, a + 3 );
+
+    EXPECT_THROWS( expectsAll( v ) );
+    EXPECT_THROWS( ensuresAll( v ) );
+    EXPECT_THROWS( assertAll( v ) );
+}
+
+CASE( "gsl_ExpectsAllDebug(), gsl_ExpectsAllAudit(): Respect the contract checking level" )
+{
+    int a[] = { -1 };
+    std::vector<int> v( a, a + 1 );
+
+#if !defined( NDEBUG ) || defined( gsl_CONFIG_CONTRACT_CHECKING_AUDIT )
+    EXPECT_THROWS( expectsAllDebug( v ) );
+#else
+    EXPECT_NO_THROW( expectsAllDebug( v ) );
+#endif
+#if defined( gsl_CONFIG_CONTRACT_CHECKING_AUDIT )
+    EXPECT_THROWS( expectsAllAudit( v ) );
+#else
+    EXPECT_NO_THROW( expectsAllAudit( v ) );
+#endif
+}
+
+CASE( "gsl_ExpectsTagged(): Behaves like gsl_Expects() for a tag with default contract traits" )
+{
+    EXPECT_NO_THROW( expectsDefaultTag( true ) );
+#if defined( gsl_CONFIG_CONTRACT_CHECKING_OFF )
+    EXPECT_NO_THROW( expectsDefaultTag( false ) );
+#else
+    EXPECT_THROWS( expectsDefaultTag( false ) );
+#endif
+}
+
+CASE( "gsl_ExpectsTagged(): Does not check contracts for a tag with checking level `off`" )
+{
+    EXPECT_NO_THROW( expectsUncheckedTag( true ) );
+    EXPECT_NO_THROW( expectsUncheckedTag( false ) );
+}
+
+CASE( "gsl_ExpectsTaggedAudit(): Checks contracts for a tag with checking level `audit`" )
+{
+    EXPECT_NO_THROW( expectsAuditTag( true ) );
+    EXPECT_THROWS( expectsAuditTag( false ) );
+}
+
+CASE( "gsl_EnsuresTagged(), gsl_AssertTaggedDebug(): Call the violation handler of the tag" )
+{
+    ContractViolationLog::count = 0;
+    EXPECT( ensuresLoggingTag( true ) );
+    EXPECT( ContractViolationLog::count == 0 );
+    EXPECT( ! ensuresLoggingTag( false ) );
+    EXPECT( ContractViolationLog::count == 1 );
+    EXPECT( std::string( ContractViolationLog::expression ) == "x" );
+    EXPECT( std::string( ContractViolationLog::message ) == "postcondition" );
+    EXPECT( ! assertDebugLoggingTag( false ) );
+    EXPECT( ContractViolationLog::count == 2 );
+    EXPECT( std::string( ContractViolationLog::message ) == "" );
+}
+
 int myAt( int i, std::vector<int> const& v )
 {
     // The arguments to `__assume( x )` (MSVC) and `__builtin_assume( x )` (Clang) are never evaluated, so they cannot incur side-effects. We would like to implement
@@ -361,4 +535,117 @@ CASE( "gsl_Verify(): Supports explicit conversions to bool, return value" )
     EXPECT( gsl_Verify( ConvertibleToBool() ) );
 }
 
+CASE( "fail_fast: Provides structured access to the contract violation" )
+{
+    gsl_lite::fail_fast e( "x > 0", "precondition", "file.cpp", 42 );
+
+    EXPECT( std::string( e.expression() ) == "x > 0" );
+    EXPECT( std::string( e.message() ) == "precondition" );
+    EXPECT( std::string( e.file_name() ) == "file.cpp" );
+    EXPECT( e.line() == 42u );
+    EXPECT( std::string( e.what() ) == "assertion failed: `precondition: x > 0' at file.cpp:42" );
+}
+
+CASE( "fail_fast: Reports no element index for other contract violations" )
+{
+    gsl_lite::fail_fast e( "x > 0", "precondition", "file.cpp", 42 );
+
+    EXPECT( e.element_index() == static_cast<std::size_t>( -1 ) );
+}
+
+CASE( "fail_fast: Omits empty message" )
+{
+    gsl_lite::fail_fast e( "x > 0", "", "file.cpp", 0 );
+
+    EXPECT( std::string( e.what() ) == "assertion failed: `x > 0' at file.cpp:0" );
+}
+
+CASE( "fail_fast: Supports preformatted message" )
+{
+    gsl_lite::fail_fast e( "something went wrong" );
+
+    EXPECT( std::string( e.what() ) == "something went wrong" );
+    EXPECT( std::string( e.expression() ) == "" );
+    EXPECT( e.line() == 0u );
+}
+
+CASE( "fail_fast: Message returned by what() is owned by the exception object" )
+{
+    gsl_lite::fail_fast a( "x > 0", "precondition", "a.cpp", 1 );
+    gsl_lite::fail_fast b( "y > 0", "postcondition", "b.cpp", 2 );
+
+    char const * whatA = a.what();
+    char const * whatB = b.what();
+    gsl_lite::fail_fast c( a );
+
+    EXPECT( std::string( whatA ) == "assertion failed: `precondition: x > 0' at a.cpp:1" );
+    EXPECT( std::string( whatB ) == "assertion failed: `postcondition: y > 0' at b.cpp:2" );
+    EXPECT( std::string( c.what() ) == std::string( whatA ) );
+}
+
+CASE( "fail_fast: Truncates overly long messages" )
+{
+    std::string expression( 2000, 'x' );
+    gsl_lite::fail_fast e( expression.c_str(), "", "file.cpp", 1 );
+
+    std::string what = e.what();
+    EXPECT( what.size() < expression.size() );
+    EXPECT( what.compare( 0, 19, "assertion failed: `" ) == 0 );
+}
+
+#if defined( gsl_CONFIG_CONTRACT_VIOLATION_THROWS )
+CASE( "gsl_Expects(): Throws fail_fast with contract violation details" )
+{
+    bool caught = false;
+    try
+    {
+        expects( false );
+    }
+    catch ( gsl_lite::fail_fast const & e )
+    {
+        caught = true;
+        EXPECT( std::string( e.expression() ) == "x" );
+        EXPECT( std::string( e.message() ) == "precondition" );
+        EXPECT( std::string( e.file_name() ).find( "assert.t.cpp" ) != std::string::npos );
+        EXPECT( e.line() > 0u );
+    }
+    EXPECT( caught );
+}
+
+CASE( "gsl_ExpectsAll(), gsl_AssertAll(): Report the index of the first element violating the predicate" )
+{
+    int a[] = { 1, 2, 0, -1 };
+    std::vector<int> v( a, a + 4 );
+
+    std::string expectsMessage, expectsWhat, assertMessage, assertWhat;
+    std::size_t expectsIndex = 0, assertIndex = 0;
+    try
+    {
+        expectsAll( v );
+    }
+    catch ( gsl_lite::fail_fast const & e )
+    {
+        expectsMessage = e.message();
+        expectsWhat = e.what();
+        expectsIndex = e.element_index();
+    }
+    try
+    {
+        assertAll( v );
+    }
+    catch ( gsl_lite::fail_fast const & e )
+    {
+        assertMessage = e.message();
+        assertWhat = e.what();
+        assertIndex = e.element_index();
+    }
+    EXPECT( expectsMessage == "precondition" );
+    EXPECT( expectsIndex == 2u );
+    EXPECT( expectsWhat.find( "assertion failed: `precondition violated by element 2: ::gsl_lite::all_of(" ) == 0u );
+    EXPECT( assertMessage == "" );
+    EXPECT( assertIndex == 2u );
+    EXPECT( assertWhat.find( "assertion failed: `violated by element 2: ::gsl_lite::all_of(" ) == 0u );
+}
+#endif // defined( gsl_CONFIG_CONTRACT_VIOLATION_THROWS )
+
 // end of file
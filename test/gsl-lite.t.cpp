@@ -244,6 +244,11 @@ CASE( "gsl-lite configuration" "[.gsl-configuration]" )
     gsl_PRINT_BOOLEAN( gsl_CONFIG( ALLOWS_NONSTRICT_SPAN_COMPARISON ) );
     gsl_PRINT_BOOLEAN( gsl_CONFIG( ALLOWS_UNCONSTRAINED_SPAN_CONTAINER_CTOR ) );
     gsl_PRINT_BOOLEAN( gsl_CONFIG( NARROW_THROWS_ON_TRUNCATION ) );
+    gsl_PRINT_BOOLEAN( gsl_CONFIG( USE_CRT_ASSERTION_HANDLER ) );
+    gsl_PRINT_BOOLEAN( gsl_CONFIG( USE_SIGNAL_SAFE_ASSERTION_HANDLER ) );
+    gsl_PRINT_BOOLEAN( gsl_CONFIG( SIGNAL_SAFE_ASSERTION_HANDLER_PRINTS_BACKTRACE ) );
+    gsl_PRINT_BOOLEAN( gsl_CONFIG( RAW_STACKTRACE ) );
+    gsl_PRINT_BOOLEAN( gsl_CONFIG( TRACK_OWNERS ) );
 }
 
 CASE( "gsl-lite features" "[.gsl-features]" )
@@ -254,6 +259,20 @@ CASE( "gsl-lite features" "[.gsl-features]" )
     gsl_PRINT_BOOLEAN( gsl_FEATURE( IMPLICIT_MACRO ) );
     gsl_PRINT_BOOLEAN( gsl_FEATURE( OWNER_MACRO ) );
     gsl_PRINT_BOOLEAN( gsl_FEATURE( EXPERIMENTAL_RETURN_GUARD ) );
+    gsl_PRINT_BOOLEAN( gsl_FEATURE( EXPERIMENTAL_ATOMIC_NOT_NULL ) );
+    gsl_PRINT_BOOLEAN( gsl_FEATURE( EXPERIMENTAL_INTRUSIVE_PTR ) );
+    gsl_PRINT_BOOLEAN( gsl_FEATURE( EXPERIMENTAL_SLOT_MAP ) );
+    gsl_PRINT_BOOLEAN( gsl_FEATURE( EXPERIMENTAL_ARENA ) );
+    gsl_PRINT_BOOLEAN( gsl_FEATURE( EXPERIMENTAL_OBJECT_POOL ) );
+    gsl_PRINT_BOOLEAN( gsl_FEATURE( EXPERIMENTAL_INPLACE_VECTOR ) );
+    gsl_PRINT_BOOLEAN( gsl_FEATURE( EXPERIMENTAL_DYN_ARRAY ) );
+    gsl_PRINT_BOOLEAN( gsl_FEATURE( EXPERIMENTAL_SMALL_BUFFER ) );
+    gsl_PRINT_BOOLEAN( gsl_FEATURE( EXPERIMENTAL_SPSC_RING ) );
+    gsl_PRINT_BOOLEAN( gsl_FEATURE( EXPERIMENTAL_MPMC_QUEUE ) );
+    gsl_PRINT_BOOLEAN( gsl_FEATURE( EXPERIMENTAL_CIRCULAR_SPAN ) );
+    gsl_PRINT_BOOLEAN( gsl_FEATURE( EXPERIMENTAL_PARALLEL ) );
+    gsl_PRINT_BOOLEAN( gsl_FEATURE( EXPERIMENTAL_SORT ) );
+    gsl_PRINT_BOOLEAN( gsl_FEATURE( EXPERIMENTAL_NUMERIC ) );
     gsl_PRINT_BOOLEAN( gsl_FEATURE( GSL_LITE_NAMESPACE ) );
 }
 
@@ -2047,4 +2047,629 @@ CASE( "not_null<>: Free function get() preserves non-nullability" )
 #endif // gsl_HAVE( UNIQUE_PTR ) && gsl_HAVE( EXPRESSION_SFINAE )
 }
 
+CASE( "optional_not_null<>: Layout is compatible to underlying type" )
+{
+#if gsl_HAVE( TYPE_TRAITS )
+    static_assert( sizeof( optional_not_null< int* > ) == sizeof( int* ), "static assertion failed" );
+# if ! gsl_BETWEEN( gsl_COMPILER_GNUC_VERSION, 1, 500 )
+    static_assert( std::is_trivially_copyable< optional_not_null< int* > >::value, "static assertion failed" );
+# endif
+# if gsl_HAVE( UNIQUE_PTR )
+    static_assert( sizeof( optional_not_null< unique_ptr< int > > ) == sizeof( unique_ptr< int > ), "static assertion failed" );
+# endif // gsl_HAVE( UNIQUE_PTR )
+# if gsl_HAVE( SHARED_PTR )
+    static_assert( sizeof( optional_not_null< shared_ptr< int > > ) == sizeof( shared_ptr< int > ), "static assertion failed" );
+# endif // gsl_HAVE( SHARED_PTR )
+#endif
+}
+
+CASE( "optional_not_null<>: Is disengaged when default-constructed or constructed from a null pointer" )
+{
+    int * np = gsl_nullptr;
+    optional_not_null< int* > o1;
+    optional_not_null< int* > o2( np );
+    EXPECT( ! o1.has_value() );
+    EXPECT( ! o2.has_value() );
+    EXPECT(( as_nullable( o1 ) == gsl_nullptr ));
+#if gsl_HAVE( NULLPTR )
+    optional_not_null< int* > o3 = nullptr;
+    EXPECT( ! o3.has_value() );
+    EXPECT(( o3 == nullptr ));
+#endif
+}
+
+CASE( "optional_not_null<>: Terminates access to disengaged value" )
+{
+    optional_not_null< int* > o;
+
+    EXPECT_THROWS( (void) o.value() );
+    EXPECT_THROWS( (void) o.operator->() );
+    EXPECT_THROWS( (void) *o );
+}
+
+CASE( "optional_not_null<>: Converts from and to not_null<> and underlying type" )
+{
+    int i = 42;
+    not_null< int* > nnp( &i );
+    optional_not_null< int* > o( nnp );
+    EXPECT( o.has_value() );
+    EXPECT( *o == 42 );
+    EXPECT(( o.value() == nnp ));
+    EXPECT( as_nullable( o ) == &i );
+
+    not_null< int* > nnq = o.value();
+    EXPECT( nnq == &i );
+
+    optional_not_null< int* > o2 = &i;
+    EXPECT(( o2 == o ));
+    o2.reset();
+    EXPECT( ! o2.has_value() );
+    EXPECT(( o2 != o ));
+    o2 = optional_not_null< int* >( nnp );
+    EXPECT(( o2 == o ));
+
+    optional_not_null< int const* > oc( nnp );
+    EXPECT( as_nullable( oc ) == &i );
+
+#if gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( DEFAULT_FUNCTION_TEMPLATE_ARG )
+    // Copy-initialization and assignment from `not_null<>` are unambiguous only if the conversion operators of `not_null<>` are constrained.
+    optional_not_null< int* > o3 = nnp;
+    EXPECT(( o3 == o ));
+    o3.reset();
+    o3 = nnp;
+    EXPECT(( o3 == o ));
+#endif
+}
+
+CASE( "optional_not_null<>: Supports move-only smart pointers" )
+{
+#if gsl_HAVE( UNIQUE_PTR )
+    optional_not_null< std::unique_ptr< int > > o( gsl_lite::make_unique< int >( 42 ) );
+    EXPECT( o.has_value() );
+    EXPECT( *o == 42 );
+# if gsl_HAVE( FUNCTION_REF_QUALIFIER )
+    not_null< std::unique_ptr< int > > nnup = std::move( o ).value();
+    EXPECT( *nnup == 42 );
+# endif
+    o = gsl_lite::make_unique< int >( 43 );
+    std::unique_ptr< int > up = as_nullable( std::move( o ) );
+    EXPECT( *up == 43 );
+    o.reset();
+    EXPECT( ! o.has_value() );
+#endif // gsl_HAVE( UNIQUE_PTR )
+}
+
+CASE( "optional_not_null<>: Hashes match the hashes of the wrapped pointer" )
+{
+#if gsl_HAVE( HASH )
+    int i = 42;
+    optional_not_null< int* > o( &i );
+    optional_not_null< int* > e;
+    EXPECT( std::hash< optional_not_null< int* > >()( o ) == std::hash< int* >()( &i ) );
+    EXPECT( std::hash< optional_not_null< int* > >()( e ) == std::hash< int* >()( gsl_nullptr ) );
+#endif // gsl_HAVE( HASH )
+}
+
+CASE( "not_null_tagged<>: Layout is compatible to underlying pointer type" )
+{
+#if gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( SIZED_TYPES )
+    static_assert( sizeof( not_null_tagged< int*, 2 > ) == sizeof( int* ), "static assertion failed" );
+#endif
+}
+
+#if gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( SIZED_TYPES )
+namespace {
+
+struct GraphNode
+{
+    int value;
+    not_null_tagged< GraphNode*, 1 > next;  // `GraphNode` is incomplete here
+
+    explicit GraphNode( int _value )
+    : value( _value ), next( this )
+    {
+    }
+};
+
+} // anonymous namespace
+#endif // gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( SIZED_TYPES )
+
+CASE( "not_null_tagged<>: Stores pointer and tag independently" )
+{
+#if gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( SIZED_TYPES )
+    int i = 42;
+    int j = 43;
+    not_null_tagged< int*, 2 > p( make_not_null( &i ), 3 );
+    EXPECT( p.tag() == 3u );
+    EXPECT( *p == 42 );
+    EXPECT( p.operator->() == &i );
+    EXPECT( p.pointer() == &i );
+
+    p.set_tag( 1 );
+    EXPECT( p.tag() == 1u );
+    EXPECT( *p == 42 );
+
+    p.set_pointer( make_not_null( &j ) );
+    EXPECT( p.tag() == 1u );
+    EXPECT( *p == 43 );
+
+    not_null_tagged< int*, 2 > q( &j, 1 );
+    EXPECT(( p == q ));
+    q.set_tag( 0 );
+    EXPECT(( p != q ));
+#endif // gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( SIZED_TYPES )
+}
+
+CASE( "not_null_tagged<>: Supports element types which are incomplete at the point of declaration" )
+{
+#if gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( SIZED_TYPES )
+    GraphNode a( 1 );
+    GraphNode b( 2 );
+    a.next = not_null_tagged< GraphNode*, 1 >( &b, 1 );
+    EXPECT( a.next->value == 2 );
+    EXPECT( a.next.tag() == 1u );
+    EXPECT( b.next->value == 2 );
+    EXPECT( b.next.tag() == 0u );
+#endif // gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( SIZED_TYPES )
+}
+
+CASE( "not_null_tagged<>: Terminates construction from null pointer, misaligned pointer or out-of-range tag" )
+{
+#if gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( SIZED_TYPES )
+    int i = 42;
+    int * np = gsl_nullptr;
+    int * mp = reinterpret_cast< int * >( reinterpret_cast< char * >( &i ) + 1 );
+
+    EXPECT_THROWS( ( not_null_tagged< int*, 2 >( np ) ) );
+    EXPECT_THROWS( ( not_null_tagged< int*, 2 >( mp ) ) );
+    EXPECT_THROWS( ( not_null_tagged< int*, 2 >( &i, 4 ) ) );
+
+    not_null_tagged< int*, 2 > p( &i );
+    EXPECT_THROWS( p.set_tag( 4 ) );
+#endif // gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( SIZED_TYPES )
+}
+
+CASE( "atomic_not_null_tagged<>: Updates pointer and tag atomically (gsl_FEATURE_EXPERIMENTAL_ATOMIC_NOT_NULL)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_ATOMIC_NOT_NULL ) && gsl_HAVE( TYPE_TRAITS ) && gsl_HAVE( SIZED_TYPES )
+    typedef not_null_tagged< int*, 2 > tagged;
+    int i = 42;
+    int j = 43;
+    atomic_not_null_tagged< int*, 2 > a( tagged( &i, 1 ) );
+    EXPECT(( a.load() == tagged( &i, 1 ) ));
+
+    tagged expected( &i, 0 );
+    EXPECT_NOT( a.compare_exchange_strong( expected, tagged( &j, 2 ) ) );
+    EXPECT(( expected == tagged( &i, 1 ) ));
+    EXPECT( a.compare_exchange_strong( expected, tagged( &j, 2 ) ) );
+    EXPECT(( a.load() == tagged( &j, 2 ) ));
+
+    tagged old = a.exchange( tagged( &i, 3 ) );
+    EXPECT(( old == tagged( &j, 2 ) ));
+    a.store( tagged( &j, 0 ) );
+    EXPECT( *a.load() == 43 );
+#else
+    EXPECT( !!"atomic_not_null_tagged<> not available (no gsl_FEATURE_EXPERIMENTAL_ATOMIC_NOT_NULL)" );
+#endif
+}
+
+CASE( "atomic_not_null<>: Loads, stores and exchanges non-null pointers (gsl_FEATURE_EXPERIMENTAL_ATOMIC_NOT_NULL)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_ATOMIC_NOT_NULL ) && gsl_STDLIB_CPP11_OR_GREATER
+    int i = 42;
+    int j = 43;
+    atomic_not_null< int* > a( make_not_null( &i ) );
+    not_null< int* > p = a.load();
+    EXPECT( p == &i );
+    EXPECT( *a.load() == 42 );
+
+    not_null< int* > expected = make_not_null( &j );
+    EXPECT_NOT( a.compare_exchange_strong( expected, make_not_null( &j ) ) );
+    EXPECT( expected == &i );
+    EXPECT( a.compare_exchange_strong( expected, make_not_null( &j ) ) );
+    EXPECT( a.load() == &j );
+
+    not_null< int* > old = a.exchange( make_not_null( &i ) );
+    EXPECT( old == &j );
+    a.store( make_not_null( &j ) );
+    EXPECT( *a.load() == 43 );
+#else
+    EXPECT( !!"atomic_not_null<> not available (no gsl_FEATURE_EXPERIMENTAL_ATOMIC_NOT_NULL)" );
+#endif
+}
+
+#if gsl_FEATURE( EXPERIMENTAL_ATOMIC_NOT_NULL ) && gsl_STDLIB_CPP11_OR_GREATER
+namespace {
+
+struct Snapshot
+{
+    static int instances;
+
+    int version;
+
+    explicit Snapshot( int _version ) : version( _version ) { ++instances; }
+    ~Snapshot() { --instances; }
+};
+int Snapshot::instances = 0;
+
+} // anonymous namespace
+#endif // gsl_FEATURE( EXPERIMENTAL_ATOMIC_NOT_NULL ) && gsl_STDLIB_CPP11_OR_GREATER
+
+CASE( "hazard_pointer_domain<>: Defers reclamation of protected objects (gsl_FEATURE_EXPERIMENTAL_ATOMIC_NOT_NULL)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_ATOMIC_NOT_NULL ) && gsl_STDLIB_CPP11_OR_GREATER
+    {
+        hazard_pointer_domain< Snapshot, 4 > domain;
+        atomic_not_null< Snapshot* > current( make_not_null( new Snapshot( 1 ) ) );
+        {
+            hazard_pointer_domain< Snapshot, 4 >::guard g( domain );
+            not_null< Snapshot* > s = g.protect( current );
+            EXPECT( s->version == 1 );
+
+            domain.retire( current.exchange( make_not_null( new Snapshot( 2 ) ) ) );
+            domain.reclaim();
+            EXPECT( Snapshot::instances == 2 );  // still protected
+            EXPECT( s->version == 1 );
+        }
+        domain.reclaim();
+        EXPECT( Snapshot::instances == 1 );
+
+        domain.retire( current.exchange( make_not_null( new Snapshot( 3 ) ) ) );
+        EXPECT( Snapshot::instances == 2 );  // reclaimed lazily
+        delete as_nullable( current.load() );
+    }
+    EXPECT( Snapshot::instances == 0 );  // reclaimed when the domain is destroyed
+#endif // gsl_FEATURE( EXPERIMENTAL_ATOMIC_NOT_NULL ) && gsl_STDLIB_CPP11_OR_GREATER
+}
+
+CASE( "hazard_pointer_domain<>: Terminates if too many guards are active (gsl_FEATURE_EXPERIMENTAL_ATOMIC_NOT_NULL)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_ATOMIC_NOT_NULL ) && gsl_STDLIB_CPP11_OR_GREATER
+    typedef hazard_pointer_domain< Snapshot, 2 > domain_type;
+    domain_type domain;
+    domain_type::guard g1( domain );
+    {
+        domain_type::guard g2( domain );
+        EXPECT_THROWS( domain_type::guard g3( domain ) );
+    }
+    domain_type::guard g4( domain );
+#endif // gsl_FEATURE( EXPERIMENTAL_ATOMIC_NOT_NULL ) && gsl_STDLIB_CPP11_OR_GREATER
+}
+
+CASE( "not_null<>: Free function borrow() returns a raw not_null<> pointer" )
+{
+#if gsl_HAVE( EXPRESSION_SFINAE )
+# if gsl_HAVE( UNIQUE_PTR )
+    not_null< std::unique_ptr< int > > nnup = gsl_lite::make_unique< int >( 41 );
+    not_null< int * > nnp = gsl_lite::borrow( nnup );
+    EXPECT( *nnp == 41 );
+    EXPECT(( nnp == gsl_lite::get( nnup ) ));
+    not_null< int * > nnp2 = gsl_lite::borrow( nnp );  // pass through
+    EXPECT(( nnp2 == nnp ));
+# endif // gsl_HAVE( UNIQUE_PTR )
+# if gsl_HAVE( SHARED_PTR )
+    not_null< std::shared_ptr< int const > > nnsp = gsl_lite::make_shared< int const >( 42 );
+    not_null< int const * > nncp = gsl_lite::borrow( nnsp );
+    EXPECT( *nncp == 42 );
+# endif // gsl_HAVE( SHARED_PTR )
+#endif // gsl_HAVE( EXPRESSION_SFINAE )
+}
+
+CASE( "scoped_borrow<>: Provides access to the borrowed object" )
+{
+#if gsl_HAVE( EXPRESSION_SFINAE ) && gsl_HAVE( SHARED_PTR )
+    not_null< std::shared_ptr< MyDerived > > owner = gsl_lite::make_shared< MyDerived >();
+    scoped_borrow< std::shared_ptr< MyDerived > > b( owner );
+    not_null< MyDerived * > p = b;
+    EXPECT(( p == gsl_lite::get( owner ) ));
+    EXPECT( b.operator->() == owner.operator->().get() );
+    EXPECT( &*b == owner.operator->().get() );
+    not_null< MyBase * > pb = b.get();
+    EXPECT(( pb == p ));
+
+    // The owner must outlive the `scoped_borrow<>`, so it cannot be a temporary.
+    static_assert( ! std::is_constructible< scoped_borrow< std::shared_ptr< MyDerived > >, not_null< std::shared_ptr< MyDerived > > >::value,
+        "scoped_borrow<> must not borrow from a temporary" );
+    static_assert( std::is_constructible< scoped_borrow< std::shared_ptr< MyDerived > >, not_null< std::shared_ptr< MyDerived > > & >::value,
+        "scoped_borrow<> must borrow from an lvalue" );
+#endif // gsl_HAVE( EXPRESSION_SFINAE ) && gsl_HAVE( SHARED_PTR )
+}
+
+CASE( "scoped_borrow<>: Terminates access if the owner no longer holds the borrowed object" )
+{
+#if gsl_HAVE( EXPRESSION_SFINAE ) && gsl_HAVE( UNIQUE_PTR ) && ( !defined( NDEBUG ) || defined( gsl_CONFIG_CONTRACT_CHECKING_AUDIT ) )
+    not_null< std::unique_ptr< int > > owner = gsl_lite::make_unique< int >( 42 );
+    scoped_borrow< std::unique_ptr< int > > b( owner );
+    EXPECT( *b == 42 );
+
+    owner = gsl_lite::make_unique< int >( 43 );  // borrowed object is destroyed
+    EXPECT_THROWS( (void) *b );
+    EXPECT_THROWS( (void) b.get() );
+
+    not_null< std::unique_ptr< int > > other( std::move( owner ) );  // owner is moved from
+    EXPECT_THROWS( (void) b.operator->() );
+#endif // gsl_HAVE( EXPRESSION_SFINAE ) && gsl_HAVE( UNIQUE_PTR ) && ( !defined( NDEBUG ) || defined( gsl_CONFIG_CONTRACT_CHECKING_AUDIT ) )
+}
+
+CASE( "not_null_span<>: Validates pointers on construction" )
+{
+    int i = 1, j = 2, k = 3;
+    int * ptrs[] = { &i, &j, &k };
+    not_null_span< int > s( ptrs );
+    EXPECT( s.size() == 3u );
+    EXPECT( ! s.empty() );
+    EXPECT( *s[ 0 ] == 1 );
+    EXPECT( *s[ 2 ] == 3 );
+    EXPECT( s.data() == &ptrs[ 0 ] );
+
+    not_null_span< int > s2( &ptrs[ 1 ], 2 );
+    EXPECT( *s2[ 0 ] == 2 );
+
+    ptrs[ 1 ] = gsl_nullptr;
+    EXPECT_THROWS( (void) not_null_span< int >( ptrs ) );
+    EXPECT_THROWS( (void) not_null_span< int >( &ptrs[ 0 ], 3 ) );
+    EXPECT_NO_THROW( (void) not_null_span< int >( &ptrs[ 2 ], 1 ) );
+}
+
+CASE( "not_null_span<>: Views arrays of not_null<> pointers without validation" )
+{
+    int i = 1, j = 2;
+    not_null< int * > nnptrs[] = { make_not_null( &i ), make_not_null( &j ) };
+    not_null_span< int > s( nnptrs );
+    EXPECT( s.size() == 2u );
+    EXPECT( *s[ 0 ] == 1 );
+    EXPECT( *s[ 1 ] == 2 );
+
+    not_null_span< int > s2( &nnptrs[ 1 ], 1 );
+    EXPECT( *s2[ 0 ] == 2 );
+}
+
+CASE( "not_null_span<>: Supports iteration and subviews" )
+{
+    int v[] = { 1, 2, 3, 4 };
+    int * ptrs[] = { &v[ 0 ], &v[ 1 ], &v[ 2 ], &v[ 3 ] };
+    not_null_span< int > s( ptrs );
+
+    int sum = 0;
+    for ( not_null_span< int >::iterator it = s.begin(); it != s.end(); ++it )
+    {
+        not_null< int * > p = *it;
+        sum += *p;
+    }
+    EXPECT( sum == 10 );
+
+    EXPECT( s.first( 1 ).size() == 1u );
+    EXPECT( *s.first( 1 )[ 0 ] == 1 );
+    EXPECT( *s.last( 1 )[ 0 ] == 4 );
+    EXPECT( *s.subspan( 1, 2 )[ 1 ] == 3 );
+    EXPECT( s.subspan( 4, 0 ).empty() );
+
+    EXPECT_THROWS( (void) s[ 4 ] );
+    EXPECT_THROWS( (void) s.first( 5 ) );
+    EXPECT_THROWS( (void) s.subspan( 3, 2 ) );
+}
+
+CASE( "not_null_span<>: Rejects negative indices and sizes" )
+{
+    int v[] = { 1, 2 };
+    int * ptrs[] = { &v[ 0 ], &v[ 1 ] };
+    not_null< int * > nnptrs[] = { make_not_null( &v[ 0 ] ), make_not_null( &v[ 1 ] ) };
+    not_null_span< int > s( ptrs );
+
+        // -1 if `gsl_CONFIG_SPAN_INDEX_TYPE` is signed, and the largest representable value otherwise; both must be rejected.
+    not_null_span< int >::size_type const minusOne = static_cast< not_null_span< int >::size_type >( -1 );
+
+    EXPECT_THROWS( (void) s[ minusOne ] );
+    EXPECT_THROWS( (void) s.first( minusOne ) );
+    EXPECT_THROWS( (void) s.last( minusOne ) );
+    EXPECT_THROWS( (void) s.subspan( minusOne, 1 ) );
+    EXPECT_THROWS( (void) s.subspan( 1, minusOne ) );
+    EXPECT_THROWS( (void) not_null_span< int >( &ptrs[ 0 ], minusOne ) );
+    EXPECT_THROWS( (void) not_null_span< int >( &nnptrs[ 0 ], minusOne ) );
+}
+
+CASE( "not_null_span<>: Converts from span<>" )
+{
+#if gsl_FEATURE( SPAN )
+    int i = 1, j = 2;
+    int * ptrs[] = { &i, &j };
+    not_null_span< int > s = span< int * >( ptrs );
+    EXPECT( *s[ 1 ] == 2 );
+
+    not_null< int * > nnptrs[] = { make_not_null( &i ), make_not_null( &j ) };
+    not_null_span< int > s2 = span< not_null< int * > >( nnptrs );
+    EXPECT( *s2[ 0 ] == 1 );
+
+    ptrs[ 0 ] = gsl_nullptr;
+    EXPECT_THROWS( (void) not_null_span< int >( span< int * >( ptrs ) ) );
+#endif // gsl_FEATURE( SPAN )
+}
+
+#if gsl_HAVE( VARIADIC_TEMPLATE ) && gsl_HAVE( EXPRESSION_SFINAE ) && gsl_HAVE( TYPE_TRAITS )
+namespace {
+
+int twice( int x ) { return 2 * x; }
+
+struct Accumulator
+{
+    int total;
+
+    Accumulator() : total( 0 ) { }
+    int add( int x ) { total += x; return total; }
+    int get() const { return total; }
+};
+
+int apply( not_null_function_ref< int( int ) > f, int x )
+{
+    return f( x );
+}
+
+} // anonymous namespace
+#endif // gsl_HAVE( VARIADIC_TEMPLATE ) && gsl_HAVE( EXPRESSION_SFINAE ) && gsl_HAVE( TYPE_TRAITS )
+
+CASE( "not_null_function_ref<>: Refers to functions and function pointers" )
+{
+#if gsl_HAVE( VARIADIC_TEMPLATE ) && gsl_HAVE( EXPRESSION_SFINAE ) && gsl_HAVE( TYPE_TRAITS )
+    EXPECT( sizeof( not_null_function_ref< int( int ) > ) == 2 * sizeof( void * ) );
+
+    EXPECT( apply( twice, 3 ) == 6 );
+    EXPECT( apply( &twice, 4 ) == 8 );
+
+    int ( *fp )( int ) = &twice;
+    EXPECT( apply( fp, 5 ) == 10 );
+    EXPECT( apply( make_not_null( fp ), 6 ) == 12 );
+
+    fp = gsl_nullptr;
+    EXPECT_THROWS( apply( fp, 1 ) );
+#else
+    EXPECT( !!"not_null_function_ref<> not available (no C++11)" );
+#endif
+}
+
+CASE( "not_null_function_ref<>: Refers to callable objects without copying them" )
+{
+#if gsl_HAVE( VARIADIC_TEMPLATE ) && gsl_HAVE( EXPRESSION_SFINAE ) && gsl_HAVE( TYPE_TRAITS )
+    int offset = 1;
+    EXPECT( apply( [ &offset ]( int x ) { return x + offset; }, 2 ) == 3 );
+
+    int calls = 0;
+    auto counter = [ &calls ]( int x ) { ++calls; return x; };
+    not_null_function_ref< int( int ) > f( counter );
+    EXPECT( f( 7 ) == 7 );
+    EXPECT( f( 8 ) == 8 );
+    EXPECT( calls == 2 );
+
+    not_null_function_ref< int( int ) > g = f;
+    EXPECT( g( 9 ) == 9 );
+    EXPECT( calls == 3 );
+
+    // The result is discarded for `void` return types and converted otherwise.
+    not_null_function_ref< void( int ) > v( counter );
+    v( 1 );
+    EXPECT( calls == 4 );
+    not_null_function_ref< long( int ) > l( counter );
+    EXPECT( l( 2 ) == 2L );
+#else
+    EXPECT( !!"not_null_function_ref<> not available (no C++11)" );
+#endif
+}
+
+CASE( "not_null_function_ref<>: Refers to member functions through nontype<>" )
+{
+#if gsl_HAVE( VARIADIC_TEMPLATE ) && gsl_HAVE( EXPRESSION_SFINAE ) && gsl_HAVE( TYPE_TRAITS )
+    // A pointer to member function would have to be referred to by address, so it is rejected like by `std::function_ref<>`.
+    static_assert( ! std::is_constructible< not_null_function_ref< int( Accumulator &, int ) >, int ( Accumulator::* )( int ) >::value,
+        "not_null_function_ref<> must not refer to a pointer to member function" );
+
+# if gsl_CPP17_OR_GREATER
+    Accumulator acc;
+
+    // The references are stored and called after the expressions which created them have ended.
+    not_null_function_ref< int( Accumulator &, int ) > add( nontype< &Accumulator::add > );
+    not_null_function_ref< int( Accumulator *, int ) > addThrough( nontype< &Accumulator::add > );
+    not_null_function_ref< int( Accumulator const & ) > get( nontype< &Accumulator::get > );
+    EXPECT( add( acc, 3 ) == 3 );
+    EXPECT( addThrough( &acc, 4 ) == 7 );
+    EXPECT( get( acc ) == 7 );
+
+    not_null_function_ref< int( int ) > bound( nontype< &Accumulator::add >, acc );
+    EXPECT( sizeof( bound ) == 2 * sizeof( void * ) );
+    EXPECT( bound( 1 ) == 8 );
+    EXPECT( apply( bound, 2 ) == 10 );
+    EXPECT( acc.total == 10 );
+
+    EXPECT( apply( nontype< &twice >, 5 ) == 10 );
+# else
+    EXPECT( !!"nontype<> not available (no C++17)" );
+# endif // gsl_CPP17_OR_GREATER
+#else
+    EXPECT( !!"not_null_function_ref<> not available (no C++11)" );
+#endif
+}
+
+#if gsl_FEATURE( EXPERIMENTAL_INTRUSIVE_PTR ) && gsl_STDLIB_CPP11_OR_GREATER
+namespace {
+
+template< class CounterPolicy >
+struct Counted : intrusive_ref_counter< Counted< CounterPolicy >, CounterPolicy >
+{
+    static int instances;
+
+    int value;
+
+    explicit Counted( int _value ) : value( _value ) { ++instances; }
+    ~Counted() { --instances; }
+};
+template< class CounterPolicy >
+int Counted< CounterPolicy >::instances = 0;
+
+template< class CounterPolicy >
+void testIntrusivePtr( lest::env & lest_env )
+{
+    typedef Counted< CounterPolicy > C;
+    {
+        not_null< intrusive_ptr< C > > p = make_not_null_intrusive< C >( 42 );
+        EXPECT( sizeof( intrusive_ptr< C > ) == sizeof( C * ) );
+        EXPECT( C::instances == 1 );
+        EXPECT( p->value == 42 );
+        EXPECT( p->use_count() == 1 );
+        {
+            not_null< intrusive_ptr< C > > q = p;
+            EXPECT( p->use_count() == 2 );
+            EXPECT(( q == p ));
+        }
+        EXPECT( p->use_count() == 1 );
+
+        intrusive_ptr< C > r = as_nullable( p );
+        EXPECT( r->use_count() == 2 );
+        r.reset();
+        EXPECT(( r == nullptr ));
+        EXPECT( p->use_count() == 1 );
+    }
+    EXPECT( C::instances == 0 );
+}
+
+} // anonymous namespace
+#endif // gsl_FEATURE( EXPERIMENTAL_INTRUSIVE_PTR ) && gsl_STDLIB_CPP11_OR_GREATER
+
+CASE( "intrusive_ptr<>: Shares ownership with atomic or non-atomic reference counts (gsl_FEATURE_EXPERIMENTAL_INTRUSIVE_PTR)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_INTRUSIVE_PTR ) && gsl_STDLIB_CPP11_OR_GREATER
+    testIntrusivePtr< thread_safe_counter >( lest_env );
+    testIntrusivePtr< thread_unsafe_counter >( lest_env );
+#else
+    EXPECT( !!"intrusive_ptr<> not available (no gsl_FEATURE_EXPERIMENTAL_INTRUSIVE_PTR)" );
+#endif
+}
+
+CASE( "intrusive_ptr<>: Supports adopting, detaching, and null pointers (gsl_FEATURE_EXPERIMENTAL_INTRUSIVE_PTR)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_INTRUSIVE_PTR ) && gsl_STDLIB_CPP11_OR_GREATER
+    typedef Counted< thread_unsafe_counter > C;
+
+    intrusive_ptr< C > p( new C( 1 ) );
+    EXPECT( p->use_count() == 1 );
+
+    C * raw = p.detach();
+    EXPECT( !p );
+    EXPECT( raw->use_count() == 1 );
+
+    p.reset( raw, false );  // adopt the reference released by detach()
+    EXPECT( p->use_count() == 1 );
+
+    intrusive_ptr< C > q( std::move( p ) );
+    EXPECT(( p == nullptr ));
+    EXPECT( q->use_count() == 1 );
+
+    p = gsl_nullptr;
+    EXPECT_THROWS( (void) not_null< intrusive_ptr< C > >( p ) );
+    EXPECT( std::hash< intrusive_ptr< C > >()( q ) == std::hash< C * >()( q.get() ) );
+
+    q.reset();
+    EXPECT( C::instances == 0 );
+#else
+    EXPECT( !!"intrusive_ptr<> not available (no gsl_FEATURE_EXPERIMENTAL_INTRUSIVE_PTR)" );
+#endif
+}
+
 // end of file
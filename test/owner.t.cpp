@@ -64,4 +64,72 @@ CASE( "owner<>: Allows its use as the (pointer) type it stands for" )
 #endif
 }
 
+CASE( "gsl_TRACK_OWNER(), gsl_UNTRACK_OWNER(): Return their argument" )
+{
+    int * p = gsl_TRACK_OWNER( new int( 42 ) );
+
+    EXPECT( *p == 42 );
+
+    int * q = gsl_UNTRACK_OWNER( p );
+
+    EXPECT( q == p );
+    delete q;
+}
+
+CASE( "gsl_TRACK_OWNER(), gsl_UNTRACK_OWNER(): Record live owners with their allocation site" )
+{
+#if gsl_CONFIG( TRACK_OWNERS )
+    std::size_t const before = gsl_lite::live_owner_count();
+
+    int * p = gsl_TRACK_OWNER( new int( 1 ) ); int const line = __LINE__;
+    int * q = gsl_TRACK_OWNER( new int( 2 ) );
+
+    EXPECT( gsl_lite::live_owner_count() == before + 2 );
+
+    int found = 0;
+    int found_line = 0;
+    char const * found_file = gsl_nullptr;
+    auto find_p = [ & ]( void const * o, char const * file, int l )
+    {
+        if ( o == p ) { ++found; found_file = file; found_line = l; }
+    };
+    gsl_lite::for_each_live_owner( find_p );
+
+    EXPECT( found == 1 );
+    EXPECT( found_line == line );
+    EXPECT( std::string( found_file ) == __FILE__ );
+
+    delete gsl_UNTRACK_OWNER( p );
+
+    EXPECT( gsl_lite::live_owner_count() == before + 1 );
+
+    found = 0;
+    gsl_lite::for_each_live_owner( find_p );
+
+    EXPECT( found == 0 );
+
+    delete gsl_UNTRACK_OWNER( q );
+
+    EXPECT( gsl_lite::live_owner_count() == before );
+#else
+    EXPECT( !!"owner tracking is not available (no gsl_CONFIG_TRACK_OWNERS)." );
+#endif
+}
+
+CASE( "gsl_TRACK_OWNER(), gsl_UNTRACK_OWNER(): Reuse vacated slots" )
+{
+#if gsl_CONFIG( TRACK_OWNERS )
+    std::size_t const before = gsl_lite::live_owner_count();
+
+    for ( std::size_t i = 0; i != 3 * gsl_lite::detail::owner_registry::capacity; ++i )
+    {
+        delete gsl_UNTRACK_OWNER( gsl_TRACK_OWNER( new std::size_t( i ) ) );
+    }
+
+    EXPECT( gsl_lite::live_owner_count() == before );
+#else
+    EXPECT( !!"owner tracking is not available (no gsl_CONFIG_TRACK_OWNERS)." );
+#endif
+}
+
 // end of file
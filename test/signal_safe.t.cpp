@@ -0,0 +1,163 @@
+//
+// gsl-lite is based on GSL: Guidelines Support Library.
+// For more information see https://github.com/gsl-lite/gsl-lite
+//
+// Copyright (c) 2015-2019 Martin Moene
+// Copyright (c) 2019-2021 Moritz Beutel
+// Copyright (c) 2015-2018 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "gsl-lite.t.hpp"
+
+#if defined( gsl_CONFIG_CONTRACT_VIOLATION_ASSERTS ) && gsl_CONFIG( USE_SIGNAL_SAFE_ASSERTION_HANDLER ) && ( defined( __unix__ ) || defined( __APPLE__ ) )
+# define gsl_TEST_SIGNAL_SAFE_HANDLER_ 1
+#else
+# define gsl_TEST_SIGNAL_SAFE_HANDLER_ 0
+#endif
+
+#if defined( gsl_CONFIG_CONTRACT_VIOLATION_TERMINATES_WITH_STACKTRACE ) && gsl_CONFIG( RAW_STACKTRACE ) && ( defined( __unix__ ) || defined( __APPLE__ ) )
+# define gsl_TEST_RAW_STACKTRACE_ 1
+#else
+# define gsl_TEST_RAW_STACKTRACE_ 0
+#endif
+
+#if gsl_TEST_SIGNAL_SAFE_HANDLER_ || gsl_TEST_RAW_STACKTRACE_
+# include <csignal>
+# include <string>
+# include <sys/types.h>
+# include <sys/wait.h>
+# include <unistd.h>
+
+namespace {
+
+void expects( bool x ) { gsl_Expects( x ); }
+
+void failPrecondition() { expects( false ); }
+
+# if gsl_TEST_SIGNAL_SAFE_HANDLER_
+void failLongExpression()
+{
+    static char expression[ 4096 ];
+    std::memset( expression, 'x', sizeof expression - 1 );
+    gsl_lite::detail::fail_fast_assert( expression, "", "file.cpp", 42 );
+}
+# endif // gsl_TEST_SIGNAL_SAFE_HANDLER_
+
+// Runs `f` in a child process whose standard error stream is redirected to a pipe, and returns what the child wrote.
+// `signal` receives the number of the signal which terminated the child, or 0 if it exited normally.
+std::string runInChild( void ( *f )(), int & signal )
+{
+    int fds[ 2 ];
+    if ( ::pipe( fds ) != 0 )
+    {
+        signal = -1;
+        return std::string();
+    }
+    pid_t pid = ::fork();
+    if ( pid == 0 )
+    {
+        ::close( fds[ 0 ] );
+        ::dup2( fds[ 1 ], STDERR_FILENO );
+        ::close( fds[ 1 ] );
+        f();
+        ::_exit( 0 );
+    }
+    ::close( fds[ 1 ] );
+    std::string output;
+    char buffer[ 256 ];
+    for ( ;; )
+    {
+        ssize_t n = ::read( fds[ 0 ], buffer, sizeof buffer );
+        if ( n <= 0 ) break;
+        output.append( buffer, static_cast<std::size_t>( n ) );
+    }
+    ::close( fds[ 0 ] );
+    int status = 0;
+    ::waitpid( pid, &status, 0 );
+    signal = WIFSIGNALED( status ) ? WTERMSIG( status ) : 0;
+    return output;
+}
+
+bool endsWith( std::string const & s, char const * suffix )
+{
+    std::size_t n = std::strlen( suffix );
+    return s.size() >= n && s.compare( s.size() - n, n, suffix ) == 0;
+}
+
+# if gsl_TEST_RAW_STACKTRACE_
+// Checks whether `s` has a line of the form "  #<n> <module>+0x<offset>".
+bool hasModuleFrame( std::string const & s )
+{
+    for ( std::size_t pos = s.find( "\n  #" ); pos != std::string::npos; pos = s.find( "\n  #", pos + 1 ) )
+    {
+        std::size_t const end = s.find( '\n', pos + 1 );
+        std::string const line = s.substr( pos + 1, end == std::string::npos ? std::string::npos : end - pos - 1 );
+        std::size_t const offset = line.find( "+0x" );
+        if ( line.find( ' ', 3 ) != std::string::npos && offset != std::string::npos && offset + 3 < line.size()
+            && line.find_first_not_of( "0123456789abcdef", offset + 3 ) == std::string::npos )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+# endif // gsl_TEST_RAW_STACKTRACE_
+
+} // anonymous namespace
+
+#endif // gsl_TEST_SIGNAL_SAFE_HANDLER_ || gsl_TEST_RAW_STACKTRACE_
+
+CASE( "signal-safe assertion handler: Writes the contract violation to stderr and aborts" )
+{
+#if gsl_TEST_SIGNAL_SAFE_HANDLER_
+    int signal = 0;
+    std::string output = runInChild( &failPrecondition, signal );
+
+    EXPECT( signal == SIGABRT );
+    EXPECT( output.find( __FILE__ ":" ) == 0u );
+    EXPECT( output.find( ": Assertion failed: `precondition: x'\n" ) != std::string::npos );
+    EXPECT( endsWith( output, "'\n" ) );
+#else
+    EXPECT( !!"signal-safe assertion handler not tested (no gsl_CONFIG_USE_SIGNAL_SAFE_ASSERTION_HANDLER, or not a POSIX platform)" );
+#endif
+}
+
+CASE( "signal-safe assertion handler: Truncates long expressions but keeps the trailing newline" )
+{
+#if gsl_TEST_SIGNAL_SAFE_HANDLER_
+    int signal = 0;
+    std::string output = runInChild( &failLongExpression, signal );
+
+    EXPECT( signal == SIGABRT );
+    EXPECT( output.find( "file.cpp:42: Assertion failed: `xxx" ) == 0u );
+    EXPECT( output.size() == 1024u );
+    EXPECT( endsWith( output, "x'\n" ) );
+#else
+    EXPECT( !!"signal-safe assertion handler not tested (no gsl_CONFIG_USE_SIGNAL_SAFE_ASSERTION_HANDLER, or not a POSIX platform)" );
+#endif
+}
+
+CASE( "raw stack trace: Writes the contract violation and the module offsets of the return addresses to stderr" )
+{
+#if gsl_TEST_RAW_STACKTRACE_
+    int signal = 0;
+    std::string output = runInChild( &failPrecondition, signal );
+
+    EXPECT( signal == SIGABRT );  // `std::terminate()` calls `std::abort()`
+    EXPECT( output.find( "assertion failed: precondition: `x' at:\n" ) == 0u );
+    EXPECT( hasModuleFrame( output ) );
+#else
+    EXPECT( !!"raw stack trace not tested (no gsl_CONFIG_RAW_STACKTRACE, or not a POSIX platform)" );
+#endif
+}
+
+// end of file
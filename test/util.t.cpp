@@ -18,12 +18,19 @@
 
 #include "gsl-lite.t.hpp"
 #include <cstddef>
+#include <cstring>
+#include <algorithm>
 #include <complex>
 #include <functional>
+#include <numeric>
+#include <vector>
 
 #if gsl_STDLIB_CPP11_OR_GREATER
+# include <atomic>
+# include <chrono>
 # include <limits>
 # include <cstdint>
+# include <thread>
 #endif // gsl_STDLIB_CPP11_OR_GREATER
 
 #define gsl_STDLIB_CPP11_OR_GREATER_WRT_FINAL ( gsl_STDLIB_CPP11_OR_GREATER || gsl_COMPILER_MSVC_VERSION >= 110 )
@@ -579,4 +586,1391 @@ CASE( "gsl_DEFINE_ENUM_BITMASK_OPERATORS(): Allow explicit conversion to bool" )
 
 #endif // gsl_HAVE( ENUM_CLASS ) && gsl_HAVE( TYPE_TRAITS )
 
+CASE( "slot_map<>: Inserts, looks up, and erases objects by key (gsl_FEATURE_EXPERIMENTAL_SLOT_MAP)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_SLOT_MAP ) && gsl_STDLIB_CPP11_OR_GREATER
+    slot_map< int > m;
+    slot_map_key k1 = m.insert( 1 );
+    slot_map_key k2 = m.insert( 2 );
+    slot_map_key k3 = m.emplace( 3 );
+    EXPECT( m.size() == 3u );
+    EXPECT( *m.get( k1 ) == 1 );
+    EXPECT( *m.get( k2 ) == 2 );
+    EXPECT( *m.get( k3 ) == 3 );
+
+    m.erase( k1 );  // moves the last element into the gap
+    EXPECT( m.size() == 2u );
+    EXPECT( ! m.contains( k1 ) );
+    EXPECT( *m.get( k3 ) == 3 );
+    EXPECT( m.data()[ 0 ] == 3 );
+    EXPECT(( m.key_at( 0 ) == k3 ));
+
+    slot_map_key k4 = m.insert( 4 );  // reuses the slot of `k1` with a new generation
+    EXPECT( k4.index == k1.index );
+    EXPECT( k4.generation != k1.generation );
+    EXPECT( ! m.contains( k1 ) );
+    EXPECT( *m.get( k4 ) == 4 );
+
+    EXPECT( ! m.find( k1 ).has_value() );
+    EXPECT( *m.find( k2 ).value() == 2 );
+
+    int sum = 0;
+    for ( int v : m )
+    {
+        sum += v;
+    }
+    EXPECT( sum == 9 );
+#else
+    EXPECT( !!"slot_map<> not available (no gsl_FEATURE_EXPERIMENTAL_SLOT_MAP)" );
+#endif
+}
+
+CASE( "slot_map<>: Terminates on access through stale or invalid keys (gsl_FEATURE_EXPERIMENTAL_SLOT_MAP)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_SLOT_MAP ) && gsl_STDLIB_CPP11_OR_GREATER
+    slot_map< int > m;
+    slot_map_key k = m.insert( 1 );
+    m.erase( k );
+
+    EXPECT_THROWS( (void) m.get( k ) );
+    EXPECT_THROWS( m.erase( k ) );
+    EXPECT_THROWS( (void) m.get( slot_map_key() ) );
+
+    slot_map_key k2 = m.insert( 2 );
+    m.clear();
+    EXPECT( m.empty() );
+    EXPECT( ! m.contains( k2 ) );
+    EXPECT_THROWS( (void) m.get( k2 ) );
+#else
+    EXPECT( !!"slot_map<> not available (no gsl_FEATURE_EXPERIMENTAL_SLOT_MAP)" );
+#endif
+}
+
+#if gsl_FEATURE( EXPERIMENTAL_ARENA ) && gsl_STDLIB_CPP11_OR_GREATER
+namespace {
+
+struct Point
+{
+    int x, y;
+    Point( int _x, int _y ) : x( _x ), y( _y ) { }
+};
+
+bool isAligned( void const * p, std::size_t alignment )
+{
+    return reinterpret_cast< std::uintptr_t >( p ) % alignment == 0;
+}
+
+} // anonymous namespace
+#endif // gsl_FEATURE( EXPERIMENTAL_ARENA ) && gsl_STDLIB_CPP11_OR_GREATER
+
+CASE( "monotonic_arena: Creates objects and buffers (gsl_FEATURE_EXPERIMENTAL_ARENA)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_ARENA ) && gsl_STDLIB_CPP11_OR_GREATER
+    monotonic_arena arena( 64 );
+
+    not_null< Point * > p = arena.make< Point >( 1, 2 );
+    EXPECT( p->x == 1 );
+    EXPECT( p->y == 2 );
+
+    void * raw = as_nullable( arena.allocate( 3, 64 ) );
+    EXPECT( isAligned( raw, 64 ) );
+
+    // Allocations larger than the block size get their own block.
+    void * big = as_nullable( arena.allocate( 1000 ) );
+    EXPECT( isAligned( big, alignof( std::max_align_t ) ) );
+    std::memset( big, 0xFF, 1000 );
+    EXPECT( p->x == 1 );
+
+# if gsl_FEATURE( SPAN )
+    span< int > s = arena.allocate_span< int >( 100 );
+    EXPECT( s.size() == 100u );
+    EXPECT( s[ 0 ] == 0 );
+    EXPECT( s[ 99 ] == 0 );
+    span< double > aligned = arena.allocate_span< double >( 4, 32 );
+    EXPECT( isAligned( aligned.data(), 32 ) );
+# endif // gsl_FEATURE( SPAN )
+#else
+    EXPECT( !!"monotonic_arena not available (no gsl_FEATURE_EXPERIMENTAL_ARENA)" );
+#endif
+}
+
+CASE( "monotonic_arena: Reuses memory after reset() (gsl_FEATURE_EXPERIMENTAL_ARENA)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_ARENA ) && gsl_STDLIB_CPP11_OR_GREATER
+    alignas( std::max_align_t ) char buffer[ 128 ];
+    monotonic_arena arena( buffer, sizeof buffer, 256 );
+
+    void * first = as_nullable( arena.allocate( 100 ) );
+    EXPECT( first == static_cast< void * >( buffer ) );
+    void * second = as_nullable( arena.allocate( 100 ) );  // does not fit in `buffer`
+    void * third = as_nullable( arena.allocate( 100 ) );
+
+    arena.reset();
+    EXPECT( as_nullable( arena.allocate( 100 ) ) == first );
+    EXPECT( as_nullable( arena.allocate( 100 ) ) == second );
+    EXPECT( as_nullable( arena.allocate( 100 ) ) == third );
+
+    EXPECT_THROWS( (void) arena.allocate( 1, 3 ) );  // alignment must be a power of 2
+
+    arena.release();
+    EXPECT( as_nullable( arena.allocate( 100 ) ) == first );
+#else
+    EXPECT( !!"monotonic_arena not available (no gsl_FEATURE_EXPERIMENTAL_ARENA)" );
+#endif
+}
+
+CASE( "arena_memory_resource: Adapts monotonic_arena to std::pmr::memory_resource (gsl_FEATURE_EXPERIMENTAL_ARENA)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_ARENA ) && defined( __cpp_lib_memory_resource )
+    monotonic_arena arena;
+    arena_memory_resource resource( arena );
+    std::pmr::vector< int > v( &resource );
+    for ( int i = 0; i != 100; ++i )
+    {
+        v.push_back( i );
+    }
+    EXPECT( v[ 99 ] == 99 );
+    EXPECT( &resource.arena() == &arena );
+#else
+    EXPECT( !!"arena_memory_resource not available (no gsl_FEATURE_EXPERIMENTAL_ARENA or no std::pmr::memory_resource)" );
+#endif
+}
+
+#if gsl_FEATURE( EXPERIMENTAL_OBJECT_POOL ) && gsl_STDLIB_CPP11_OR_GREATER
+namespace {
+
+struct Message
+{
+    static int instances;
+
+    int id;
+
+    explicit Message( int _id ) : id( _id ) { ++instances; }
+    ~Message() { --instances; }
+};
+int Message::instances = 0;
+
+} // anonymous namespace
+#endif // gsl_FEATURE( EXPERIMENTAL_OBJECT_POOL ) && gsl_STDLIB_CPP11_OR_GREATER
+
+CASE( "object_pool<>: Constructs and destroys objects in a fixed number of slots (gsl_FEATURE_EXPERIMENTAL_OBJECT_POOL)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_OBJECT_POOL ) && gsl_STDLIB_CPP11_OR_GREATER
+    object_pool< Message > pool( 2 );
+    EXPECT( pool.capacity() == 2u );
+
+    not_null< owner< Message * > > m1 = pool.allocate( 1 );
+    not_null< owner< Message * > > m2 = pool.allocate( 2 );
+    EXPECT( m1->id == 1 );
+    EXPECT( m2->id == 2 );
+    EXPECT( Message::instances == 2 );
+    EXPECT( pool.owns( as_nullable( m1 ) ) );
+
+    EXPECT( ! pool.try_allocate( 3 ).has_value() );
+    EXPECT_THROWS( (void) pool.allocate( 3 ) );
+
+    pool.deallocate( m1 );
+    EXPECT( Message::instances == 1 );
+    optional_not_null< owner< Message * > > m3 = pool.try_allocate( 3 );
+    EXPECT( m3.has_value() );
+    EXPECT( m3.value()->id == 3 );
+
+    Message outside( 4 );
+    EXPECT( ! pool.owns( &outside ) );
+    EXPECT_THROWS( pool.deallocate( make_not_null( &outside ) ) );
+
+    pool.deallocate( m3.value() );
+    pool.deallocate( m2 );
+    EXPECT( Message::instances == 1 );
+#else
+    EXPECT( !!"object_pool<> not available (no gsl_FEATURE_EXPERIMENTAL_OBJECT_POOL)" );
+#endif
+}
+
+CASE( "object_pool<>: Exchanges slots with thread caches in batches (gsl_FEATURE_EXPERIMENTAL_OBJECT_POOL)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_OBJECT_POOL ) && gsl_STDLIB_CPP11_OR_GREATER
+    object_pool< Message > pool( 8 );
+    std::vector< Message * > messages;
+    {
+        object_pool< Message >::thread_cache< 4 > cache( pool );
+        for ( int i = 0; i != 8; ++i )
+        {
+            messages.push_back( as_nullable( cache.allocate( i ) ) );
+        }
+        EXPECT( Message::instances == 8 );
+        EXPECT_THROWS( (void) cache.allocate( 8 ) );
+        EXPECT( ! pool.try_allocate( 8 ).has_value() );
+
+        for ( std::size_t i = 0; i != messages.size(); ++i )
+        {
+            cache.deallocate( make_not_null( messages[ i ] ) );
+        }
+        EXPECT( Message::instances == 0 );
+
+        // The cache holds at most 4 slots; the others have been returned to the pool.
+        optional_not_null< owner< Message * > > m = pool.try_allocate( 0 );
+        EXPECT( m.has_value() );
+        pool.deallocate( m.value() );
+    }
+    // The remaining slots are returned when the cache is destroyed.
+    messages.clear();
+    for ( int i = 0; i != 8; ++i )
+    {
+        messages.push_back( as_nullable( pool.allocate( i ) ) );
+    }
+    for ( std::size_t i = 0; i != messages.size(); ++i )
+    {
+        pool.deallocate( make_not_null( messages[ i ] ) );
+    }
+    EXPECT( Message::instances == 0 );
+#else
+    EXPECT( !!"object_pool<> not available (no gsl_FEATURE_EXPERIMENTAL_OBJECT_POOL)" );
+#endif
+}
+
+#if gsl_FEATURE( EXPERIMENTAL_INPLACE_VECTOR ) && gsl_STDLIB_CPP11_OR_GREATER && gsl_FEATURE( SPAN )
+namespace {
+
+int sum( span< int const > values )
+{
+    int result = 0;
+    for ( int value : values )
+    {
+        result += value;
+    }
+    return result;
+}
+
+} // anonymous namespace
+#endif // gsl_FEATURE( EXPERIMENTAL_INPLACE_VECTOR ) && gsl_STDLIB_CPP11_OR_GREATER && gsl_FEATURE( SPAN )
+
+CASE( "inplace_vector<>: Stores up to N elements without allocating (gsl_FEATURE_EXPERIMENTAL_INPLACE_VECTOR)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_INPLACE_VECTOR ) && gsl_STDLIB_CPP11_OR_GREATER
+    inplace_vector< int, 4 > v;
+    EXPECT( v.empty() );
+    EXPECT( v.capacity() == 4u );
+
+    v.push_back( 1 );
+    v.push_back( 2 );
+    EXPECT( v.emplace_back( 3 ) == 3 );
+    EXPECT( v.size() == 3u );
+    EXPECT( v.front() == 1 );
+    EXPECT( v.back() == 3 );
+    EXPECT( v[ 1 ] == 2 );
+    EXPECT_THROWS( (void) v[ 3 ] );
+
+    EXPECT( v.try_push_back( 4 ).has_value() );
+    EXPECT( v.full() );
+    EXPECT( ! v.try_push_back( 5 ).has_value() );
+    EXPECT_THROWS( v.push_back( 5 ) );
+    EXPECT( v.size() == 4u );
+
+    EXPECT( *v.erase( v.begin() + 1 ) == 3 );
+    EXPECT(( v == inplace_vector< int, 4 >{ 1, 3, 4 } ));
+    v.erase( v.begin(), v.end() - 1 );
+    EXPECT(( v == inplace_vector< int, 4 >{ 4 } ));
+
+    v.resize( 3 );
+    EXPECT(( v == inplace_vector< int, 4 >{ 4, 0, 0 } ));
+    v.resize( 4, 7 );
+    EXPECT( v.back() == 7 );
+    EXPECT_THROWS( v.resize( 5 ) );
+
+    v.pop_back();
+    EXPECT( v.size() == 3u );
+    v.clear();
+    EXPECT( v.empty() );
+    EXPECT_THROWS( v.pop_back() );
+    typedef inplace_vector< int, 2 > vector2;
+    EXPECT_THROWS( (void) vector2( 3 ) );
+
+    static_assert( std::is_trivially_copyable< inplace_vector< int, 4 > >::value, "inplace_vector<> of trivial type must be trivially copyable" );
+    static_assert( ! std::is_trivially_copyable< inplace_vector< std::string, 4 > >::value, "inplace_vector<> of non-trivial type cannot be trivially copyable" );
+#else
+    EXPECT( !!"inplace_vector<> not available (no gsl_FEATURE_EXPERIMENTAL_INPLACE_VECTOR)" );
+#endif
+}
+
+CASE( "inplace_vector<>: Copies, moves and destroys non-trivial elements (gsl_FEATURE_EXPERIMENTAL_INPLACE_VECTOR)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_INPLACE_VECTOR ) && gsl_STDLIB_CPP11_OR_GREATER
+    typedef inplace_vector< std::string, 3 > strings;
+
+    strings a{ "one", "two" };
+    strings b( a );
+    EXPECT(( a == b ));
+
+    strings c( std::move( b ) );
+    EXPECT(( c == a ));
+
+    strings d{ "x", "y", "z" };
+    d = a;
+    EXPECT(( d == a ));
+    d = strings{ "long enough to not fit in the small string buffer" };
+    EXPECT( d.size() == 1u );
+    EXPECT( d[ 0 ] == "long enough to not fit in the small string buffer" );
+
+    std::vector< std::string > source( 4, "abc" );
+    EXPECT_THROWS( strings( source.begin(), source.end() ) );
+    strings e( source.begin(), source.begin() + 3 );
+    EXPECT( e.full() );
+    EXPECT( e.back() == "abc" );
+
+    std::shared_ptr< int > p = std::make_shared< int >( 42 );
+    {
+        inplace_vector< std::shared_ptr< int >, 2 > ptrs( 2, p );
+        EXPECT( p.use_count() == 3 );
+        ptrs.pop_back();
+        EXPECT( p.use_count() == 2 );
+    }
+    EXPECT( p.use_count() == 1 );
+#else
+    EXPECT( !!"inplace_vector<> not available (no gsl_FEATURE_EXPERIMENTAL_INPLACE_VECTOR)" );
+#endif
+}
+
+CASE( "inplace_vector<>: Converts to span<> (gsl_FEATURE_EXPERIMENTAL_INPLACE_VECTOR)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_INPLACE_VECTOR ) && gsl_STDLIB_CPP11_OR_GREATER && gsl_FEATURE( SPAN )
+    inplace_vector< int, 3 > v{ 1, 2 };
+    EXPECT( sum( v ) == 3 );
+
+    span< int > s = v;
+    EXPECT( s.data() == v.data() );
+    EXPECT( s.size() == 2u );
+
+    typedef span< int, 3 > span3;
+    v.push_back( 3 );
+    span3 full( v );
+    EXPECT( full[ 2 ] == 3 );
+
+    int values[] = { 4, 5, 6 };
+    inplace_vector< int, 3 > w{ span3( values ) };  // capacity checked at compile time
+    EXPECT( sum( w ) == 15 );
+    typedef inplace_vector< int, 3 > vector3;
+    std::vector< int > more( 4, 1 );
+    EXPECT_THROWS( (void) vector3( span< int >( more ) ) );
+#else
+    EXPECT( !!"inplace_vector<> not available (no gsl_FEATURE_EXPERIMENTAL_INPLACE_VECTOR or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "dyn_array<>: Holds a fixed number of elements allocated on construction (gsl_FEATURE_EXPERIMENTAL_DYN_ARRAY)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_DYN_ARRAY ) && gsl_STDLIB_CPP11_OR_GREATER
+    EXPECT( sizeof( dyn_array< int > ) == 2 * sizeof( void * ) );
+
+    dyn_array< int > empty;
+    EXPECT( empty.empty() );
+    EXPECT( empty.data() == nullptr );
+
+    dyn_array< int > zeros( 3 );
+    EXPECT(( zeros == dyn_array< int >{ 0, 0, 0 } ));
+
+    dyn_array< int > buffer( 1000, default_init );
+    EXPECT( buffer.size() == 1000u );
+    buffer.back() = 42;
+    EXPECT( buffer[ 999 ] == 42 );
+    EXPECT_THROWS( (void) buffer[ 1000 ] );
+
+    dyn_array< int > sevens( 2, 7 );
+    EXPECT( sevens.front() == 7 );
+    EXPECT( sevens.back() == 7 );
+
+    std::vector< int > values( 4, 1 );
+    dyn_array< int > ones( values.begin(), values.end() );
+    EXPECT( ones.size() == 4u );
+    EXPECT( std::accumulate( ones.begin(), ones.end(), 0 ) == 4 );
+
+    dyn_array< int > copy( ones );
+    EXPECT(( copy == ones ));
+    EXPECT( copy.data() != ones.data() );
+
+    int const * data = copy.data();
+    dyn_array< int > moved( std::move( copy ) );
+    EXPECT( moved.data() == data );
+    EXPECT( copy.empty() );
+
+    moved = sevens;
+    EXPECT(( moved == sevens ));
+    moved = std::move( zeros );
+    EXPECT( moved.size() == 3u );
+
+    swap( moved, sevens );
+    EXPECT( moved.size() == 2u );
+    EXPECT( sevens.size() == 3u );
+#else
+    EXPECT( !!"dyn_array<> not available (no gsl_FEATURE_EXPERIMENTAL_DYN_ARRAY)" );
+#endif
+}
+
+CASE( "dyn_array<>: Destroys non-trivial elements (gsl_FEATURE_EXPERIMENTAL_DYN_ARRAY)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_DYN_ARRAY ) && gsl_STDLIB_CPP11_OR_GREATER
+    std::shared_ptr< int > p = std::make_shared< int >( 42 );
+    {
+        dyn_array< std::shared_ptr< int > > ptrs( 3, p );
+        EXPECT( p.use_count() == 4 );
+        dyn_array< std::shared_ptr< int > > more( ptrs );
+        EXPECT( p.use_count() == 7 );
+        more = dyn_array< std::shared_ptr< int > >( 1 );
+        EXPECT( p.use_count() == 4 );
+    }
+    EXPECT( p.use_count() == 1 );
+
+    dyn_array< std::string > strings{ "one", "two" };
+    EXPECT( strings[ 1 ] == "two" );
+#else
+    EXPECT( !!"dyn_array<> not available (no gsl_FEATURE_EXPERIMENTAL_DYN_ARRAY)" );
+#endif
+}
+
+CASE( "dyn_array<>: Converts to span<> (gsl_FEATURE_EXPERIMENTAL_DYN_ARRAY)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_DYN_ARRAY ) && gsl_STDLIB_CPP11_OR_GREATER && gsl_FEATURE( SPAN )
+    dyn_array< int > a{ 1, 2, 3 };
+    span< int > s = a;
+    span< int const > cs = a;
+    EXPECT( s.data() == a.data() );
+    EXPECT( cs.size() == 3u );
+#else
+    EXPECT( !!"dyn_array<> not available (no gsl_FEATURE_EXPERIMENTAL_DYN_ARRAY or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "dyn_array<>: Allocates from a monotonic_arena with arena_allocator<> (gsl_FEATURE_EXPERIMENTAL_DYN_ARRAY, gsl_FEATURE_EXPERIMENTAL_ARENA)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_DYN_ARRAY ) && gsl_FEATURE( EXPERIMENTAL_ARENA ) && gsl_STDLIB_CPP11_OR_GREATER
+    typedef dyn_array< double, arena_allocator< double > > arena_array;
+
+    alignas( double ) unsigned char storage[ 1024 ];
+    monotonic_arena arena( storage, sizeof storage );
+    monotonic_arena other_arena;
+
+    arena_array a( 100, default_init, arena_allocator< double >( arena ) );
+    EXPECT( static_cast< void * >( a.data() ) >= static_cast< void * >( storage ) );
+    EXPECT( static_cast< void * >( a.data() + a.size() ) <= static_cast< void * >( storage + sizeof storage ) );
+
+    arena_array b( 3, 1.5, arena_allocator< double >( other_arena ) );
+    a = b;  // allocators do not propagate, so the elements are copied into `arena`
+    EXPECT(( a == b ));
+    EXPECT( &a.get_allocator().arena() == &arena );
+
+    EXPECT_THROWS( a.swap( b ) );  // precondition: equal allocators
+#else
+    EXPECT( !!"dyn_array<> with arena_allocator<> not available (no gsl_FEATURE_EXPERIMENTAL_DYN_ARRAY or no gsl_FEATURE_EXPERIMENTAL_ARENA)" );
+#endif
+}
+
+#if gsl_FEATURE( EXPERIMENTAL_SMALL_BUFFER ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+namespace {
+
+std::size_t fill( span< char > buffer, char c )
+{
+    for ( char & e : buffer )
+    {
+        e = c;
+    }
+    return buffer.size();
+}
+
+template< class T >
+struct counting_allocator
+{
+    typedef T value_type;
+
+    int * allocations;
+
+    explicit counting_allocator( int * _allocations ) : allocations( _allocations ) { }
+    template< class U >
+    counting_allocator( counting_allocator< U > const & other ) : allocations( other.allocations ) { }
+
+    T * allocate( std::size_t n ) { ++*allocations; return std::allocator< T >().allocate( n ); }
+    void deallocate( T * p, std::size_t n ) { --*allocations; std::allocator< T >().deallocate( p, n ); }
+
+    friend bool operator==( counting_allocator const & lhs, counting_allocator const & rhs ) { return lhs.allocations == rhs.allocations; }
+    friend bool operator!=( counting_allocator const & lhs, counting_allocator const & rhs ) { return !( lhs == rhs ); }
+};
+
+} // anonymous namespace
+#endif // gsl_FEATURE( EXPERIMENTAL_SMALL_BUFFER ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+
+CASE( "small_buffer<>: Stores small buffers inline and larger ones on the heap (gsl_FEATURE_EXPERIMENTAL_SMALL_BUFFER)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_SMALL_BUFFER ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    typedef small_buffer< char, 64, counting_allocator< char > > buffer;
+
+    int allocations = 0;
+    {
+        buffer small( 64, counting_allocator< char >( &allocations ) );
+        EXPECT( small.is_inline() );
+        EXPECT( allocations == 0 );
+        EXPECT( fill( small, 'a' ) == 64u );
+        EXPECT( small.as_span()[ 63 ] == 'a' );
+
+        buffer large( 65, counting_allocator< char >( &allocations ) );
+        EXPECT( ! large.is_inline() );
+        EXPECT( allocations == 1 );
+        EXPECT( fill( large, 'b' ) == 65u );
+
+        buffer const & clarge = large;
+        span< char const > s = clarge;
+        EXPECT( s.size() == 65u );
+        EXPECT( s[ 64 ] == 'b' );
+    }
+    EXPECT( allocations == 0 );
+
+    small_buffer< std::string, 2 > strings( 3 );
+    EXPECT( strings.as_span()[ 2 ].empty() );
+#else
+    EXPECT( !!"small_buffer<> not available (no gsl_FEATURE_EXPERIMENTAL_SMALL_BUFFER or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "small_buffer<>: Falls back to a monotonic_arena with arena_allocator<> (gsl_FEATURE_EXPERIMENTAL_SMALL_BUFFER, gsl_FEATURE_EXPERIMENTAL_ARENA)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_SMALL_BUFFER ) && gsl_FEATURE( EXPERIMENTAL_ARENA ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    alignas( int ) unsigned char storage[ 4096 ];
+    monotonic_arena arena( storage, sizeof storage );
+
+    small_buffer< int, 16, arena_allocator< int > > workspace( 1000, arena_allocator< int >( arena ) );
+    span< int > s = workspace;
+    EXPECT( static_cast< void * >( s.data() ) >= static_cast< void * >( storage ) );
+    EXPECT( static_cast< void * >( s.data() + s.size() ) <= static_cast< void * >( storage + sizeof storage ) );
+#else
+    EXPECT( !!"small_buffer<> with arena_allocator<> not available (no gsl_FEATURE_EXPERIMENTAL_SMALL_BUFFER or no gsl_FEATURE_EXPERIMENTAL_ARENA)" );
+#endif
+}
+
+CASE( "spsc_ring<>: Passes elements from producer to consumer in order (gsl_FEATURE_EXPERIMENTAL_SPSC_RING)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_SPSC_RING ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    int storage[ 4 ];
+    spsc_ring< int > ring( storage );
+    EXPECT( ring.capacity() == 4u );
+
+    int value = 0;
+    EXPECT( ! ring.try_pop( value ) );
+    EXPECT( ring.try_push( 1 ) );
+    EXPECT( ring.try_push( 2 ) );
+    EXPECT( ring.size() == 2u );
+    EXPECT( ring.try_pop( value ) );
+    EXPECT( value == 1 );
+
+    int const values[] = { 3, 4, 5, 6 };
+    EXPECT( ring.try_push( values ) == 3u );  // wraps around; one element does not fit
+    EXPECT( ! ring.try_push( 7 ) );
+
+    int out[ 8 ] = { };
+    EXPECT( ring.try_pop( out ) == 4u );
+    EXPECT( out[ 0 ] == 2 );
+    EXPECT( out[ 3 ] == 5 );
+    EXPECT( ring.size() == 0u );
+
+    std::vector< int > odd( 3 );
+    EXPECT_THROWS( spsc_ring< int >{ odd } );
+#else
+    EXPECT( !!"spsc_ring<> not available (no gsl_FEATURE_EXPERIMENTAL_SPSC_RING or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "spsc_ring<>: Provides zero-copy access to readable elements (gsl_FEATURE_EXPERIMENTAL_SPSC_RING)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_SPSC_RING ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    std::string storage[ 4 ];
+    spsc_ring< std::string > ring( storage );
+
+    EXPECT( ring.peek().size() == 0u );
+
+    std::string const values[] = { "a", "b", "c" };
+    EXPECT( ring.try_push( values ) == 3u );
+    ring.consume( 2 );
+    EXPECT( ring.try_push( "d" ) );
+    EXPECT( ring.try_push( "e" ) );
+
+    spsc_ring< std::string >::segments readable = ring.peek();
+    EXPECT( readable.size() == 3u );
+    EXPECT( readable.first.size() == 2u );
+    EXPECT( readable.first[ 0 ] == "c" );
+    EXPECT( readable.first[ 1 ] == "d" );
+    EXPECT( readable.second.size() == 1u );
+    EXPECT( readable.second[ 0 ] == "e" );
+    EXPECT( readable.second.data() == &storage[ 0 ] );
+
+    EXPECT_THROWS( ring.consume( 4 ) );
+    ring.consume( 3 );
+    EXPECT( ring.size() == 0u );
+#else
+    EXPECT( !!"spsc_ring<> not available (no gsl_FEATURE_EXPERIMENTAL_SPSC_RING or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "spsc_ring<>: Passes elements in order between a producer and a consumer thread (gsl_FEATURE_EXPERIMENTAL_SPSC_RING)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_SPSC_RING ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    std::size_t const numElements = 100000;
+    std::size_t const batchSize = 5;
+    std::size_t storage[ 8 ];
+    spsc_ring< std::size_t > ring( storage );
+
+    std::thread producer( [ &ring ]
+    {
+        // Alternates between single and batched pushes.
+        std::size_t batch[ batchSize ];
+        std::size_t next = 0;
+        while ( next != numElements )
+        {
+            std::size_t n = 0;
+            if ( next % 2 == 0 )
+            {
+                n = ring.try_push( next ) ? 1 : 0;
+            }
+            else
+            {
+                std::size_t const wanted = std::min( static_cast< std::size_t >( batchSize ), numElements - next );
+                for ( std::size_t i = 0; i != wanted; ++i )
+                {
+                    batch[ i ] = next + i;
+                }
+                n = ring.try_push( span< std::size_t const >( batch, wanted ) );
+            }
+            next += n;
+            if ( n == 0 )
+            {
+                std::this_thread::yield();
+            }
+        }
+    } );
+
+    // Alternates between batched pops and in-place access with `peek()` and `consume()`.
+    std::size_t out[ batchSize ];
+    std::size_t expected = 0;
+    bool ordered = true;
+    for ( bool usePeek = false; expected != numElements; usePeek = ! usePeek )
+    {
+        std::size_t n = 0;
+        if ( usePeek )
+        {
+            spsc_ring< std::size_t >::segments readable = ring.peek();
+            n = static_cast< std::size_t >( readable.size() );
+            for ( std::size_t i = 0; i != n; ++i )
+            {
+                std::size_t const value = i < readable.first.size() ? readable.first[ i ] : readable.second[ i - readable.first.size() ];
+                ordered = ordered && value == expected + i;
+            }
+            ring.consume( n );
+        }
+        else
+        {
+            n = ring.try_pop( span< std::size_t >( out, batchSize ) );
+            for ( std::size_t i = 0; i != n; ++i )
+            {
+                ordered = ordered && out[ i ] == expected + i;
+            }
+        }
+        expected += n;
+        if ( n == 0 )
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    EXPECT( ordered );
+    EXPECT( ring.size() == 0u );
+#else
+    EXPECT( !!"spsc_ring<> not available (no gsl_FEATURE_EXPERIMENTAL_SPSC_RING or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "mpmc_queue<>: Enqueues and dequeues elements in FIFO order (gsl_FEATURE_EXPERIMENTAL_MPMC_QUEUE)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_MPMC_QUEUE ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    mpmc_queue< int >::slot slots[ 4 ];
+    mpmc_queue< int > queue( slots );
+    EXPECT( queue.capacity() == 4u );
+
+    int value = 0;
+    EXPECT( ! queue.try_pop( value ) );
+    EXPECT( queue.try_push( 1 ) );
+    EXPECT( queue.try_pop( value ) );
+    EXPECT( value == 1 );
+
+    int const values[] = { 2, 3, 4, 5, 6 };
+    EXPECT( queue.try_push( values ) == 4u );  // wraps around; one element does not fit
+    EXPECT( ! queue.try_push( 7 ) );
+
+    int out[ 3 ] = { };
+    EXPECT( queue.try_pop( out ) == 3u );
+    EXPECT( out[ 0 ] == 2 );
+    EXPECT( out[ 2 ] == 4 );
+    EXPECT( queue.try_push( span< int const >( values + 4, 1 ) ) == 1u );
+    EXPECT( queue.try_pop( out ) == 2u );
+    EXPECT( out[ 0 ] == 5 );
+    EXPECT( out[ 1 ] == 6 );
+    EXPECT( queue.try_pop( out ) == 0u );
+
+    std::vector< mpmc_queue< int >::slot > odd( 3 );
+    EXPECT_THROWS( mpmc_queue< int >{ odd } );
+#else
+    EXPECT( !!"mpmc_queue<> not available (no gsl_FEATURE_EXPERIMENTAL_MPMC_QUEUE or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "blocking_mpmc_queue<>: Provides blocking push() and pop() (gsl_FEATURE_EXPERIMENTAL_MPMC_QUEUE)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_MPMC_QUEUE ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    blocking_mpmc_queue< std::string >::slot slots[ 2 ];
+    blocking_mpmc_queue< std::string > queue( slots );
+
+    queue.push( "a" );
+    std::string const values[] = { "b" };
+    queue.push( values );
+    EXPECT( ! queue.try_push( "c" ) );
+
+    EXPECT( queue.pop() == "a" );
+    std::string out[ 4 ];
+    EXPECT( queue.pop( out ) == 1u );
+    EXPECT( out[ 0 ] == "b" );
+    std::string value;
+    EXPECT( ! queue.try_pop( value ) );
+#else
+    EXPECT( !!"blocking_mpmc_queue<> not available (no gsl_FEATURE_EXPERIMENTAL_MPMC_QUEUE or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "blocking_mpmc_queue<>: Blocks consumers while empty and producers while full (gsl_FEATURE_EXPERIMENTAL_MPMC_QUEUE)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_MPMC_QUEUE ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    blocking_mpmc_queue< int >::slot slots[ 2 ];
+    blocking_mpmc_queue< int > queue( slots );
+
+    std::atomic< bool > popped( false );
+    int value = 0;
+    std::thread consumer( [ & ]
+    {
+        value = queue.pop();
+        popped.store( true );
+    } );
+    std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+    EXPECT( ! popped.load() );  // the queue is empty, so the consumer must still be waiting
+    queue.push( 1 );
+    consumer.join();
+    EXPECT( popped.load() );
+    EXPECT( value == 1 );
+
+    queue.push( 2 );
+    queue.push( 3 );
+    std::atomic< bool > pushed( false );
+    std::thread producer( [ & ]
+    {
+        queue.push( 4 );
+        pushed.store( true );
+    } );
+    std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+    EXPECT( ! pushed.load() );  // the queue is full, so the producer must still be waiting
+    EXPECT( queue.pop() == 2 );
+    producer.join();
+    EXPECT( pushed.load() );
+    EXPECT( queue.pop() == 3 );
+    EXPECT( queue.pop() == 4 );
+#else
+    EXPECT( !!"blocking_mpmc_queue<> not available (no gsl_FEATURE_EXPERIMENTAL_MPMC_QUEUE or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "blocking_mpmc_queue<>: Passes every element exactly once between several producers and consumers (gsl_FEATURE_EXPERIMENTAL_MPMC_QUEUE)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_MPMC_QUEUE ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    std::size_t const numThreads = 2;
+    std::size_t const numPerProducer = 20000;
+    std::size_t const batchSize = 3;
+    blocking_mpmc_queue< int >::slot slots[ 4 ];
+    blocking_mpmc_queue< int > queue( slots );
+
+    std::vector< std::thread > producers, consumers;
+    std::vector< std::vector< int > > received( numThreads );
+    for ( std::size_t t = 0; t != numThreads; ++t )
+    {
+        producers.emplace_back( [ &queue, t ]
+        {
+            // Producer `t` enqueues the values `t + 1`, `t + 1 + numThreads`, ... in batches.
+            int batch[ batchSize ];
+            for ( std::size_t i = 0; i < numPerProducer; i += batchSize )
+            {
+                std::size_t n = 0;
+                for ( ; n != batchSize && i + n != numPerProducer; ++n )
+                {
+                    batch[ n ] = static_cast< int >( t + 1 + ( i + n ) * numThreads );
+                }
+                queue.push( span< int const >( batch, n ) );
+            }
+        } );
+        consumers.emplace_back( [ &queue, &received, t ]
+        {
+            // Elements are dequeued one at a time, so every consumer receives exactly one of the terminating zeros.
+            do
+            {
+                received[ t ].push_back( queue.pop() );
+            } while ( received[ t ].back() != 0 );
+        } );
+    }
+    for ( std::thread & producer : producers )
+    {
+        producer.join();
+    }
+    for ( std::size_t t = 0; t != numThreads; ++t )
+    {
+        queue.push( 0 );
+    }
+    for ( std::thread & consumer : consumers )
+    {
+        consumer.join();
+    }
+
+    std::vector< std::size_t > count( numThreads * numPerProducer + 1 );
+    for ( std::vector< int > const & values : received )
+    {
+        for ( int value : values )
+        {
+            ++count[ static_cast< std::size_t >( value ) ];
+        }
+    }
+    EXPECT( count[ 0 ] == numThreads );
+    EXPECT( static_cast< std::size_t >( std::count( count.begin() + 1, count.end(), 1u ) ) == numThreads * numPerProducer );
+#else
+    EXPECT( !!"blocking_mpmc_queue<> not available (no gsl_FEATURE_EXPERIMENTAL_MPMC_QUEUE or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "mpmc_queue<>: Claims batches of positions concurrently without losing or duplicating elements (gsl_FEATURE_EXPERIMENTAL_MPMC_QUEUE)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_MPMC_QUEUE ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    std::size_t const numThreads = 2;
+    std::size_t const numPerProducer = 20000;
+    std::size_t const batchSize = 5;
+    mpmc_queue< int >::slot slots[ 8 ];
+    mpmc_queue< int > queue( slots );
+
+    std::atomic< std::size_t > numReceived( 0 );
+    std::vector< std::thread > threads;
+    std::vector< std::vector< int > > received( numThreads );
+    for ( std::size_t t = 0; t != numThreads; ++t )
+    {
+        threads.emplace_back( [ &queue, t ]
+        {
+            std::vector< int > values( numPerProducer );
+            for ( std::size_t i = 0; i != numPerProducer; ++i )
+            {
+                values[ i ] = static_cast< int >( t + 1 + i * numThreads );
+            }
+            span< int const > pending( values );
+            while ( ! pending.empty() )
+            {
+                std::size_t const n = queue.try_push( pending.first( std::min( static_cast< std::size_t >( batchSize ), pending.size() ) ) );
+                pending = pending.subspan( n );
+                if ( n == 0 )
+                {
+                    std::this_thread::yield();
+                }
+            }
+        } );
+        threads.emplace_back( [ &queue, &received, &numReceived, t ]
+        {
+            int batch[ batchSize ];
+            while ( numReceived.load() != numThreads * numPerProducer )
+            {
+                std::size_t const n = queue.try_pop( span< int >( batch, batchSize ) );
+                received[ t ].insert( received[ t ].end(), batch, batch + n );
+                numReceived.fetch_add( n );
+                if ( n == 0 )
+                {
+                    std::this_thread::yield();
+                }
+            }
+        } );
+    }
+    for ( std::thread & thread : threads )
+    {
+        thread.join();
+    }
+
+    std::vector< std::size_t > count( numThreads * numPerProducer + 1 );
+    for ( std::vector< int > const & values : received )
+    {
+        // Every consumer dequeues the elements of any one producer in the order in which they were enqueued.
+        int last[ numThreads ] = { };
+        bool ordered = true;
+        for ( int value : values )
+        {
+            std::size_t const producer = static_cast< std::size_t >( value - 1 ) % numThreads;
+            ordered = ordered && value > last[ producer ];
+            last[ producer ] = value;
+            ++count[ static_cast< std::size_t >( value ) ];
+        }
+        EXPECT( ordered );
+    }
+    EXPECT( count[ 0 ] == 0u );
+    EXPECT( static_cast< std::size_t >( std::count( count.begin() + 1, count.end(), 1u ) ) == numThreads * numPerProducer );
+#else
+    EXPECT( !!"mpmc_queue<> not available (no gsl_FEATURE_EXPERIMENTAL_MPMC_QUEUE or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "circular_span<>: Presents two segments as one sequence (gsl_FEATURE_EXPERIMENTAL_CIRCULAR_SPAN)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_CIRCULAR_SPAN ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    int storage[] = { 4, 5, 6, 0, 0, 1, 2, 3 };
+    circular_span< int > s( storage, 5, 6 );
+
+    EXPECT( s.size() == 6u );
+    EXPECT( ! s.empty() );
+    EXPECT( ! s.is_contiguous() );
+    EXPECT( s.first_segment().data() == &storage[ 5 ] );
+    EXPECT( s.second_segment().data() == &storage[ 0 ] );
+    EXPECT( s.front() == 1 );
+    EXPECT( s.back() == 6 );
+    for ( std::size_t i = 0; i != s.size(); ++i )
+    {
+        EXPECT( s[ i ] == static_cast< int >( i + 1 ) );
+    }
+    EXPECT_THROWS( (void) s[ 6 ] );
+
+    int expected = 1;
+    for ( int x : s )
+    {
+        EXPECT( x == expected++ );
+    }
+    EXPECT( std::accumulate( s.rbegin(), s.rend(), 0 ) == 21 );
+
+    circular_span< int >::iterator it = s.begin() + 2;
+    EXPECT( *it == 3 );
+    EXPECT( it[ 1 ] == 4 );
+    EXPECT( &*( it + 1 ) == &storage[ 0 ] );
+    EXPECT( s.end() - it == 4 );
+    EXPECT(( it < s.end() ));
+    *it = 33;
+    EXPECT( storage[ 7 ] == 33 );
+#else
+    EXPECT( !!"circular_span<> not available (no gsl_FEATURE_EXPERIMENTAL_CIRCULAR_SPAN or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "circular_span<>: Splits first(), last(), and subspan() at the seam (gsl_FEATURE_EXPERIMENTAL_CIRCULAR_SPAN)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_CIRCULAR_SPAN ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    int a[] = { 1, 2, 3 };
+    int b[] = { 4, 5 };
+    circular_span< int > s( a, b );
+
+    circular_span< int > f = s.first( 2 );
+    EXPECT( f.is_contiguous() );
+    EXPECT( f.as_contiguous().data() == &a[ 0 ] );
+    EXPECT( f.as_contiguous().size() == 2u );
+
+    circular_span< int > l = s.last( 2 );
+    EXPECT( l.is_contiguous() );
+    EXPECT( l.as_contiguous().data() == &b[ 0 ] );
+
+    circular_span< int > m = s.subspan( 1, 3 );
+    EXPECT( ! m.is_contiguous() );
+    EXPECT( m.first_segment().size() == 2u );
+    EXPECT( m.second_segment().size() == 1u );
+    EXPECT( m[ 0 ] == 2 );
+    EXPECT( m[ 2 ] == 4 );
+    EXPECT_THROWS( (void) m.as_contiguous() );
+
+    EXPECT( s.subspan( 4 ).size() == 1u );
+    EXPECT( s.subspan( 4 )[ 0 ] == 5 );
+    EXPECT( s.subspan( 5 ).empty() );
+    EXPECT_THROWS( (void) s.subspan( 6 ) );
+    EXPECT_THROWS( (void) s.subspan( 2, 4 ) );
+    EXPECT_THROWS( (void) s.first( 6 ) );
+    EXPECT_THROWS( (void) s.last( 6 ) );
+
+    circular_span< int const > c = s;
+    EXPECT( c.size() == 5u );
+    EXPECT( c.back() == 5 );
+#else
+    EXPECT( !!"circular_span<> not available (no gsl_FEATURE_EXPERIMENTAL_CIRCULAR_SPAN or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "circular_span<>: Copies its elements into a linear span (gsl_FEATURE_EXPERIMENTAL_CIRCULAR_SPAN)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_CIRCULAR_SPAN ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    int storage[] = { 3, 4, 0, 1, 2 };
+    circular_span< int const > s( make_span( storage ), 3, 4 );
+
+    int out[ 6 ] = { };
+    span< int > copied = s.copy( out );
+    EXPECT( copied.data() == &out[ 0 ] );
+    EXPECT( copied.size() == 4u );
+    EXPECT( out[ 0 ] == 1 );
+    EXPECT( out[ 3 ] == 4 );
+    EXPECT( out[ 4 ] == 0 );
+
+    int small[ 3 ];
+    EXPECT_THROWS( (void) s.copy( small ) );
+
+    EXPECT_THROWS( (void) circular_span< int >( storage, 5, 0 ) );
+    EXPECT_THROWS( (void) circular_span< int >( storage, 0, 6 ) );
+    circular_span< int > empty;
+    EXPECT( empty.empty() );
+    EXPECT( empty.is_contiguous() );
+    EXPECT(( empty.begin() == empty.end() ));
+#else
+    EXPECT( !!"circular_span<> not available (no gsl_FEATURE_EXPERIMENTAL_CIRCULAR_SPAN or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "parallel_for(): Processes cache-line-aligned partitions of a span (gsl_FEATURE_EXPERIMENTAL_PARALLEL)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_PARALLEL ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    std::vector< int > values( 10000 );
+    std::iota( values.begin(), values.end(), 0 );
+
+    std::mutex mutex;
+    std::vector< span< int > > parts;
+    thread_pool pool( 3 );
+    parallel_for( pool, span< int >( values ), 100, [ & ]( span< int > part )
+    {
+        for ( int & value : part )
+        {
+            value *= 2;
+        }
+        std::lock_guard< std::mutex > lock( mutex );
+        parts.push_back( part );
+    } );
+
+    for ( std::size_t i = 0; i != values.size(); ++i )
+    {
+        EXPECT( values[ i ] == static_cast< int >( 2 * i ) );
+    }
+    std::size_t total = 0;
+    for ( std::size_t i = 0; i != parts.size(); ++i )
+    {
+        total += static_cast< std::size_t >( parts[ i ].size() );
+        if ( parts[ i ].data() != values.data() )
+        {
+            EXPECT( reinterpret_cast< std::uintptr_t >( parts[ i ].data() ) % gsl_CONFIG_CACHE_LINE_SIZE == 0u );
+        }
+    }
+    EXPECT( total == values.size() );
+    EXPECT( parts.size() > 1u );
+
+    std::vector< int > empty;
+    bool called = false;
+    parallel_for( span< int >( empty ), 1, [ & ]( span< int > ) { called = true; } );
+    EXPECT( ! called );
+    EXPECT_THROWS( parallel_for( span< int >( values ), 0, []( span< int > ) { } ) );
+#else
+    EXPECT( !!"parallel_for() not available (no gsl_FEATURE_EXPERIMENTAL_PARALLEL or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "parallel_for(): Processes the span as a single partition if the grain is not less than its size (gsl_FEATURE_EXPERIMENTAL_PARALLEL)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_PARALLEL ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    std::vector< char > values( 1000 );
+    span< char > const s( values );
+    thread_pool pool( 2 );
+
+    std::size_t const grains[] = { values.size(), values.size() + 1, std::numeric_limits< std::size_t >::max() };
+    for ( std::size_t grain : grains )
+    {
+        std::atomic< int > calls( 0 );
+        std::atomic< std::size_t > size( 0 );
+        parallel_for( pool, s, grain, [ & ]( span< char > part )
+        {
+            ++calls;
+            size = static_cast< std::size_t >( part.size() );
+        } );
+        EXPECT( calls.load() == 1 );
+        EXPECT( size.load() == values.size() );
+    }
+    EXPECT( parallel_reduce( pool, span< char const >( s ), std::numeric_limits< std::size_t >::max(), std::size_t( 0 ),
+        []( span< char const > part ) { return static_cast< std::size_t >( part.size() ); }, std::plus< std::size_t >() ) == values.size() );
+#else
+    EXPECT( !!"parallel_for() not available (no gsl_FEATURE_EXPERIMENTAL_PARALLEL or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "parallel_for(): Rethrows contract violations in the calling thread (gsl_FEATURE_EXPERIMENTAL_PARALLEL)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_PARALLEL ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    std::vector< int > values( 1000, 1 );
+    values[ 567 ] = -1;
+
+    thread_pool pool( 2 );
+    EXPECT_THROWS( parallel_for( pool, span< int >( values ), 16, []( span< int > part )
+    {
+        for ( int value : part )
+        {
+            gsl_Expects( value >= 0 );
+        }
+    } ) );
+
+        // The pool remains usable.
+    std::atomic< int > sum( 0 );
+    parallel_for( pool, span< int >( values ), 16, [ & ]( span< int > part )
+    {
+        sum += std::accumulate( part.begin(), part.end(), 0 );
+    } );
+    EXPECT( sum.load() == 998 );
+
+    thread_pool inline_pool( 0 );
+    EXPECT( inline_pool.thread_count() == 0u );
+    EXPECT_THROWS( parallel_for( inline_pool, span< int >( values ), 16, []( span< int > part ) { (void) part[ part.size() ]; } ) );
+#else
+    EXPECT( !!"parallel_for() not available (no gsl_FEATURE_EXPERIMENTAL_PARALLEL or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "parallel_reduce(): Combines the results of all partitions in order (gsl_FEATURE_EXPERIMENTAL_PARALLEL)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_PARALLEL ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    std::vector< long long > values( 100000 );
+    std::iota( values.begin(), values.end(), 1LL );
+
+    long long const sum = parallel_reduce( span< long long const >( values ), 1000, 0LL,
+        []( span< long long const > part ) { return std::accumulate( part.begin(), part.end(), 0LL ); },
+        std::plus< long long >() );
+    EXPECT( sum == 5000050000LL );
+
+    std::string const letters = "abcdefghijklmnopqrstuvwxyz";
+    std::string const concatenated = parallel_reduce( span< char const >( letters.data(), letters.size() ), 1, std::string(),
+        []( span< char const > part ) { return std::string( part.begin(), part.end() ); },
+        std::plus< std::string >() );
+    EXPECT( concatenated == letters );
+
+    std::vector< long > empty;
+    EXPECT( parallel_reduce( span< long const >( empty ), 1, 42L, []( span< long const > ) { return 0L; }, std::plus< long >() ) == 42L );
+#else
+    EXPECT( !!"parallel_reduce() not available (no gsl_FEATURE_EXPERIMENTAL_PARALLEL or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "radix_sort(): Sorts integral and floating-point elements (gsl_FEATURE_EXPERIMENTAL_SORT)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_SORT ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    std::vector< std::uint64_t > u( 5000 );
+    std::uint64_t x = 88172645463325252ull;
+    for ( std::size_t i = 0; i != u.size(); ++i )
+    {
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        u[ i ] = i % 3 == 0 ? x : x >> 40;
+    }
+    std::vector< std::uint64_t > u_expected( u );
+    std::sort( u_expected.begin(), u_expected.end() );
+    std::vector< std::uint64_t > u_scratch( u.size() );
+    radix_sort( span< std::uint64_t >( u ), span< std::uint64_t >( u_scratch ) );
+    EXPECT(( u == u_expected ));
+
+    int i[] = { 3, -1, 0, -300000, 7, 2147483647, -2147483647 - 1, 3 };
+    int i_expected[] = { -2147483647 - 1, -300000, -1, 0, 3, 3, 7, 2147483647 };
+    int i_scratch[ 8 ];
+    radix_sort( span< int >( i ), span< int >( i_scratch ) );
+    EXPECT( std::equal( i, i + 8, i_expected ) );
+
+    double d[] = { 2.5, -0.5, 1e300, -1e-300, 0.0, -7.0, 2.25 };
+    double d_expected[] = { -7.0, -0.5, -1e-300, 0.0, 2.25, 2.5, 1e300 };
+    double d_scratch[ 7 ];
+    radix_sort( span< double >( d ), span< double >( d_scratch ) );
+    EXPECT( std::equal( d, d + 7, d_expected ) );
+
+    signed char c[] = { 5, -5, 127, -128 };
+    signed char c_scratch[ 3 ];
+    EXPECT_THROWS( radix_sort( span< signed char >( c ), span< signed char >( c_scratch ) ) );
+#else
+    EXPECT( !!"radix_sort() not available (no gsl_FEATURE_EXPERIMENTAL_SORT or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "radix_sort(): Sorts elements stably by key (gsl_FEATURE_EXPERIMENTAL_SORT)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_SORT ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    typedef std::pair< float, std::string > entry;
+    std::vector< entry > v;
+    v.push_back( entry( 1.5f, "a" ) );
+    v.push_back( entry( -2.0f, "b" ) );
+    v.push_back( entry( 1.5f, "c" ) );
+    v.push_back( entry( 0.0f, "d" ) );
+    v.push_back( entry( -2.0f, "e" ) );
+    std::vector< entry > scratch( v.size() );
+
+    radix_sort( span< entry >( v ), span< entry >( scratch ), []( entry const & e ) { return e.first; } );
+    std::string order;
+    for ( std::size_t i = 0; i != v.size(); ++i )
+    {
+        order += v[ i ].second;
+    }
+    EXPECT( order == "bedac" );
+#else
+    EXPECT( !!"radix_sort() not available (no gsl_FEATURE_EXPERIMENTAL_SORT or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "merge_sort(): Sorts elements stably with a comparator (gsl_FEATURE_EXPERIMENTAL_SORT)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_SORT ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    typedef std::pair< int, int > entry;
+    std::vector< entry > v( 50000 );
+    for ( std::size_t i = 0; i != v.size(); ++i )
+    {
+        v[ i ] = entry( static_cast< int >( ( i * 7919 ) % 1000 ), static_cast< int >( i ) );
+    }
+    std::vector< entry > expected( v );
+    std::stable_sort( expected.begin(), expected.end(), []( entry const & a, entry const & b ) { return a.first < b.first; } );
+    std::vector< entry > scratch( v.size() );
+
+    std::vector< entry > sequential( v );
+    merge_sort( span< entry >( sequential ), span< entry >( scratch ), []( entry const & a, entry const & b ) { return a.first < b.first; } );
+    EXPECT(( sequential == expected ));
+
+    std::vector< entry > generic( v );
+    gsl_lite::sort( span< entry >( generic ), span< entry >( scratch ), []( entry const & a, entry const & b ) { return a.first < b.first; } );
+    EXPECT(( generic == expected ));
+
+# if gsl_FEATURE( EXPERIMENTAL_PARALLEL )
+    thread_pool pool( 3 );
+    std::vector< entry > parallel( v );
+    merge_sort( pool, span< entry >( parallel ), span< entry >( scratch ), []( entry const & a, entry const & b ) { return a.first < b.first; } );
+    EXPECT(( parallel == expected ));
+# endif
+
+    std::vector< std::string > s;
+    s.push_back( "pear" );
+    s.push_back( "apple" );
+    s.push_back( "fig" );
+    std::vector< std::string > s_scratch( 3 );
+    gsl_lite::sort( span< std::string >( s ), span< std::string >( s_scratch ) );
+    EXPECT( s[ 0 ] == "apple" );
+    EXPECT( s[ 1 ] == "fig" );
+    EXPECT( s[ 2 ] == "pear" );
+
+    std::vector< std::string > too_small( 2 );
+    EXPECT_THROWS( merge_sort( span< std::string >( s ), span< std::string >( too_small ) ) );
+#else
+    EXPECT( !!"merge_sort() not available (no gsl_FEATURE_EXPERIMENTAL_SORT or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "inclusive_scan(), exclusive_scan(): Compute prefix sums (gsl_FEATURE_EXPERIMENTAL_NUMERIC)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_NUMERIC ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    std::uint32_t const in[] = { 3, 0, 2, 5 };
+    std::uint32_t out[ 4 ];
+
+    EXPECT( inclusive_scan( span< std::uint32_t const >( in ), span< std::uint32_t >( out ) ) == 10u );
+    EXPECT( out[ 0 ] == 3u );
+    EXPECT( out[ 1 ] == 3u );
+    EXPECT( out[ 2 ] == 5u );
+    EXPECT( out[ 3 ] == 10u );
+
+    EXPECT( exclusive_scan( span< std::uint32_t const >( in ), span< std::uint32_t >( out ) ) == 10u );
+    EXPECT( out[ 0 ] == 0u );
+    EXPECT( out[ 1 ] == 3u );
+    EXPECT( out[ 3 ] == 5u );
+
+    std::uint64_t wide[ 4 ];
+    EXPECT( exclusive_scan( span< std::uint32_t const >( in ), span< std::uint64_t >( wide ), std::uint64_t( 100 ) ) == 110u );
+    EXPECT( wide[ 0 ] == 100u );
+    EXPECT( wide[ 3 ] == 105u );
+
+    int in_place[] = { 1, -2, 3 };
+    EXPECT( inclusive_scan( span< int >( in_place ), span< int >( in_place ) ) == 2 );
+    EXPECT( in_place[ 1 ] == -1 );
+    EXPECT( in_place[ 2 ] == 2 );
+
+    EXPECT_THROWS( inclusive_scan( span< std::uint32_t const >( in ), span< std::uint32_t >( out, 3 ) ) );
+#else
+    EXPECT( !!"inclusive_scan() not available (no gsl_FEATURE_EXPERIMENTAL_NUMERIC or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "inclusive_scan_failfast(), exclusive_scan_failfast(), reduce_failfast(): Detect overflow (gsl_FEATURE_EXPERIMENTAL_NUMERIC)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_NUMERIC ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    std::uint32_t const big[] = { 0xC0000000u, 0x40000000u };
+    std::uint32_t out[ 2 ];
+    EXPECT( inclusive_scan( span< std::uint32_t const >( big ), span< std::uint32_t >( out ) ) == 0u );
+    EXPECT_THROWS( inclusive_scan_failfast( span< std::uint32_t const >( big ), span< std::uint32_t >( out ) ) );
+    EXPECT( exclusive_scan_failfast( span< std::uint32_t const >( big, 1 ), span< std::uint32_t >( out, 1 ) ) == 0xC0000000u );
+    EXPECT_THROWS( exclusive_scan_failfast( span< std::uint32_t const >( big ), span< std::uint32_t >( out ) ) );
+
+    std::uint64_t wide[ 2 ];
+    EXPECT( inclusive_scan_failfast( span< std::uint32_t const >( big ), span< std::uint64_t >( wide ) ) == 0x100000000u );
+
+    std::uint64_t const huge[] = { 0xFFFFFFFFFFFFFFFFull, 1 };
+    EXPECT_THROWS( inclusive_scan_failfast( span< std::uint64_t const >( huge ), span< std::uint64_t >( wide ) ) );
+
+    int const negative[] = { 1, -2 };
+    unsigned out_unsigned[ 2 ];
+    EXPECT_THROWS( inclusive_scan_failfast( span< int const >( negative ), span< unsigned >( out_unsigned ) ) );
+
+    long long const extremes[] = { ( std::numeric_limits< long long >::min )(), -1 };
+    EXPECT( reduce_failfast( span< long long const >( extremes, 1 ), 0LL ) == ( std::numeric_limits< long long >::min )() );
+    EXPECT_THROWS( (void) reduce_failfast( span< long long const >( extremes ), 0LL ) );
+    EXPECT( reduce_failfast( span< int const >( negative ), 0 ) == -1 );
+    EXPECT_THROWS( (void) reduce_failfast( span< std::uint32_t const >( big ), std::uint32_t( 0 ) ) );
+#else
+    EXPECT( !!"inclusive_scan_failfast() not available (no gsl_FEATURE_EXPERIMENTAL_NUMERIC or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "reduce(), minmax(): Reduce a span (gsl_FEATURE_EXPERIMENTAL_NUMERIC)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_NUMERIC ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    std::vector< int > v( 1001 );
+    std::iota( v.begin(), v.end(), -500 );
+    v[ 17 ] = 9000;
+
+    EXPECT( gsl_lite::reduce( span< int const >( v ) ) == 9000 - ( 17 - 500 ) );
+    EXPECT( gsl_lite::reduce( span< int const >( v ), 1000000000000LL ) == 1000000000000LL + 9000 - ( 17 - 500 ) );
+    EXPECT( gsl_lite::reduce( span< int const >( v.data(), 3 ) ) == -1500 + 3 );
+    EXPECT( gsl_lite::reduce( span< int const >() ) == 0 );
+
+    std::pair< int, int > const mm = gsl_lite::minmax( span< int const >( v ) );
+    EXPECT( mm.first == -500 );
+    EXPECT( mm.second == 9000 );
+
+    float const f[] = { 2.5f, -1.0f, 7.0f };
+    EXPECT( gsl_lite::minmax( span< float const >( f ) ).first == -1.0f );
+    EXPECT( gsl_lite::reduce( span< float const >( f ), 0.0 ) == 8.5 );
+
+    EXPECT_THROWS( (void) gsl_lite::minmax( span< int const >() ) );
+#else
+    EXPECT( !!"reduce() not available (no gsl_FEATURE_EXPERIMENTAL_NUMERIC or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
+CASE( "inclusive_scan(), exclusive_scan(): Compute prefix sums concurrently (gsl_FEATURE_EXPERIMENTAL_NUMERIC)" )
+{
+#if gsl_FEATURE( EXPERIMENTAL_NUMERIC ) && gsl_FEATURE( EXPERIMENTAL_PARALLEL ) && gsl_FEATURE( SPAN ) && gsl_STDLIB_CPP11_OR_GREATER
+    std::vector< std::uint32_t > in( 100000 );
+    for ( std::size_t i = 0; i != in.size(); ++i )
+    {
+        in[ i ] = static_cast< std::uint32_t >( i % 7 );
+    }
+    std::vector< std::uint32_t > expected( in.size() );
+    std::uint32_t const total = exclusive_scan( span< std::uint32_t const >( in ), span< std::uint32_t >( expected ), 5u );
+
+    thread_pool pool( 3 );
+    std::vector< std::uint32_t > out( in.size() );
+    EXPECT( exclusive_scan( pool, span< std::uint32_t const >( in ), span< std::uint32_t >( out ), 1000, 5u ) == total );
+    EXPECT(( out == expected ));
+
+    inclusive_scan( span< std::uint32_t const >( in ), span< std::uint32_t >( expected ) );
+    EXPECT( inclusive_scan( pool, span< std::uint32_t >( in ), span< std::uint32_t >( in ), 1000 ) == total - 5u );
+    EXPECT(( in == expected ));
+
+    EXPECT_THROWS( inclusive_scan( pool, span< std::uint32_t const >( in ), span< std::uint32_t >( out ), 0 ) );
+#else
+    EXPECT( !!"parallel inclusive_scan() not available (no gsl_FEATURE_EXPERIMENTAL_NUMERIC, no gsl_FEATURE_EXPERIMENTAL_PARALLEL, or no gsl_FEATURE_SPAN)" );
+#endif
+}
+
 // end of file